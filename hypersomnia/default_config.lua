@@ -229,7 +229,8 @@ treat_as_music_sounds_longer_than_secs = 5,
     regenerate_every_time = false,
 	rescan_assets_on_window_focus = true,
 	atlas_blitting_threads = 3,
-	neon_regeneration_threads = 3
+	neon_regeneration_threads = 3,
+	sound_decoding_threads = 3
   },
   debug = {
     determinism_test_cloned_cosmoi_count = 0,
@@ -295,6 +296,10 @@ treat_as_music_sounds_longer_than_secs = 5,
 	player = {
 		snapshot_interval_in_steps = 800
 	},
+	history_checkpoints = {
+		interval_in_revisions = 32,
+		memory_budget_in_megabytes = 256
+	},
     grid = {
       render = {
         alpha_multiplier = 0.5,
@@ -727,7 +732,10 @@ treat_as_music_sounds_longer_than_secs = 5,
 	send_heartbeat_to_server_list_once_every_secs = 10,
 	resolve_server_list_address_once_every_secs = 60,
     sleep_mult = 0.1,
+    precise_tick_scheduler = true,
     log_performance_once_every_secs = 1,
+    num_logic_pool_workers = 0,
+    max_join_catch_up_steps = 2000,
 
 	kick_if_no_network_payloads_for_secs = 10,
 	move_to_spectators_if_afk_for_secs = 120,
@@ -760,7 +768,7 @@ treat_as_music_sounds_longer_than_secs = 5,
   },
 
   dedicated_server = {
-
+	num_arenas = 1
   },
 
   client = {
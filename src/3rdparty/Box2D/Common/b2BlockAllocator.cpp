@@ -20,7 +20,9 @@
 #include <cstdlib>
 #include <climits>
 #include <cstring>
+#include <cstdint>
 #include <memory>
+#include <algorithm>
 
 #include "augs/build_settings/setting_debug_physics_world_cache_copy.h"
 
@@ -57,6 +59,12 @@ struct b2Block
 	b2Block* next;
 };
 
+struct b2ChunkRelocation
+{
+	uintptr_t from;
+	uintptr_t to;
+};
+
 b2BlockAllocator::b2BlockAllocator()
 {
 	b2Assert(b2_blockSizes < UCHAR_MAX);
@@ -68,6 +76,12 @@ b2BlockAllocator::b2BlockAllocator()
 	m_chunkCount = 0;
 	m_chunks = (b2Chunk*)b2Alloc(m_chunkSpace * sizeof(b2Chunk));
 
+	m_largeAllocationCount = 0;
+
+	m_relocations = NULL;
+	m_relocationCount = 0;
+	m_relocationSpace = 0;
+
 	memset(m_chunks, 0, m_chunkSpace * sizeof(b2Chunk));
 	memset(m_freeLists, 0, sizeof(m_freeLists));
 
@@ -100,6 +114,11 @@ b2BlockAllocator::~b2BlockAllocator()
 	}
 
 	b2Free(m_chunks);
+
+	if (m_relocations)
+	{
+		b2Free(m_relocations);
+	}
 }
 
 void* b2BlockAllocator::Allocate(int32 size)
@@ -115,6 +134,7 @@ void* b2BlockAllocator::Allocate(int32 size)
 
 	if (size > b2_maxBlockSize)
 	{
+		++m_largeAllocationCount;
 		return b2Alloc(size);
 	}
 
@@ -179,6 +199,7 @@ void b2BlockAllocator::Free(void* p, int32 size)
 
 	if (size > b2_maxBlockSize)
 	{
+		--m_largeAllocationCount;
 		b2Free(p);
 		return;
 	}
@@ -228,4 +249,147 @@ void b2BlockAllocator::Clear()
 	memset(m_chunks, 0, m_chunkSpace * sizeof(b2Chunk));
 
 	memset(m_freeLists, 0, sizeof(m_freeLists));
+
+	m_relocationCount = 0;
+}
+
+void b2BlockAllocator::TakeChunksFrom(b2BlockAllocator& other)
+{
+	Clear();
+	b2Free(m_chunks);
+
+	m_chunks = other.m_chunks;
+	m_chunkCount = other.m_chunkCount;
+	m_chunkSpace = other.m_chunkSpace;
+
+	other.m_chunkSpace = b2_chunkArrayIncrement;
+	other.m_chunkCount = 0;
+	other.m_chunks = (b2Chunk*)b2Alloc(other.m_chunkSpace * sizeof(b2Chunk));
+
+	memset(other.m_chunks, 0, other.m_chunkSpace * sizeof(b2Chunk));
+	memset(other.m_freeLists, 0, sizeof(other.m_freeLists));
+
+#if DEBUG_PHYSICS_WORLD_CACHE_COPY
+	m_numAllocatedObjects = 0;
+	other.m_numAllocatedObjects = 0;
+#endif
+
+	// Link the blocks in reverse so that they are handed out in the order of memory.
+	for (int32 i = m_chunkCount - 1; i >= 0; --i)
+	{
+		b2Chunk* chunk = m_chunks + i;
+		int32 blockSize = chunk->blockSize;
+		int32 index = s_blockSizeLookup[blockSize];
+		int32 blockCount = b2_chunkSize / blockSize;
+
+		for (int32 j = blockCount - 1; j >= 0; --j)
+		{
+			b2Block* block = (b2Block*)((int8*)chunk->blocks + blockSize * j);
+			block->next = m_freeLists[index];
+			m_freeLists[index] = block;
+		}
+	}
+}
+
+void b2BlockAllocator::CloneFrom(const b2BlockAllocator& other)
+{
+	b2Assert(other.m_largeAllocationCount == 0);
+
+	if (m_chunkSpace < other.m_chunkCount)
+	{
+		b2Chunk* oldChunks = m_chunks;
+		m_chunkSpace = other.m_chunkSpace;
+		m_chunks = (b2Chunk*)b2Alloc(m_chunkSpace * sizeof(b2Chunk));
+		memcpy(m_chunks, oldChunks, m_chunkCount * sizeof(b2Chunk));
+		memset(m_chunks + m_chunkCount, 0, (m_chunkSpace - m_chunkCount) * sizeof(b2Chunk));
+		b2Free(oldChunks);
+	}
+
+	// Every chunk has the same size whatever its block size, so any of ours can hold any of theirs.
+	for (int32 i = other.m_chunkCount; i < m_chunkCount; ++i)
+	{
+		b2Free(m_chunks[i].blocks);
+		m_chunks[i].blocks = NULL;
+		m_chunks[i].blockSize = 0;
+	}
+
+	for (int32 i = m_chunkCount; i < other.m_chunkCount; ++i)
+	{
+		m_chunks[i].blocks = (b2Block*)b2Alloc(b2_chunkSize);
+	}
+
+	m_chunkCount = other.m_chunkCount;
+
+	if (m_relocationSpace < m_chunkCount)
+	{
+		if (m_relocations)
+		{
+			b2Free(m_relocations);
+		}
+
+		m_relocationSpace = m_chunkSpace;
+		m_relocations = (b2ChunkRelocation*)b2Alloc(m_relocationSpace * sizeof(b2ChunkRelocation));
+	}
+
+	for (int32 i = 0; i < m_chunkCount; ++i)
+	{
+		b2Chunk* chunk = m_chunks + i;
+		const b2Chunk* source = other.m_chunks + i;
+
+		chunk->blockSize = source->blockSize;
+		memcpy(chunk->blocks, source->blocks, b2_chunkSize);
+
+		m_relocations[i].from = reinterpret_cast<uintptr_t>(source->blocks);
+		m_relocations[i].to = reinterpret_cast<uintptr_t>(chunk->blocks);
+	}
+
+	m_relocationCount = m_chunkCount;
+
+	std::sort(
+		m_relocations, 
+		m_relocations + m_relocationCount, 
+		[](const b2ChunkRelocation& a, const b2ChunkRelocation& b) { return a.from < b.from; }
+	);
+
+	// The copied free blocks still point into the other allocator.
+	for (int32 i = 0; i < b2_blockSizes; ++i)
+	{
+		m_freeLists[i] = Relocate(other.m_freeLists[i]);
+
+		for (b2Block* block = m_freeLists[i]; block; block = block->next)
+		{
+			block->next = Relocate(block->next);
+		}
+	}
+
+#if DEBUG_PHYSICS_WORLD_CACHE_COPY
+	m_numAllocatedObjects = other.m_numAllocatedObjects;
+#endif
+}
+
+void* b2BlockAllocator::RelocateVoid(const void* p) const
+{
+	if (p == NULL)
+	{
+		return NULL;
+	}
+
+	const uintptr_t address = reinterpret_cast<uintptr_t>(p);
+
+	// Find the last chunk that begins at or before the address.
+	const b2ChunkRelocation* const first = m_relocations;
+	const b2ChunkRelocation* const last = m_relocations + m_relocationCount;
+
+	const b2ChunkRelocation* const found = std::upper_bound(
+		first,
+		last,
+		address,
+		[](const uintptr_t a, const b2ChunkRelocation& r) { return a < r.from; }
+	);
+
+	b2Assert(found != first);
+	const b2ChunkRelocation& r = *(found - 1);
+	b2Assert(address - r.from < static_cast<uintptr_t>(b2_chunkSize));
+
+	return reinterpret_cast<void*>(r.to + (address - r.from));
 }
@@ -29,6 +29,7 @@ const int32 b2_chunkArrayIncrement = 128;
 
 struct b2Block;
 struct b2Chunk;
+struct b2ChunkRelocation;
 
 /// This is a small object allocator used for allocating small
 /// objects that persist for more than one time step.
@@ -47,10 +48,31 @@ public:
 
 	void Clear();
 
+	/// Take ownership of all chunks of another allocator and mark all of their blocks as free.
+	/// The other allocator is left empty. Used to reuse already touched memory between world clones.
+	void TakeChunksFrom(b2BlockAllocator& other);
+
+	/// Make this allocator a byte-for-byte copy of another one, reusing the memory of its own chunks.
+	/// Only valid if the other allocator has no allocations larger than b2_maxBlockSize,
+	/// as those do not live in any chunk. Afterwards, every pointer into the blocks of the other allocator
+	/// can be translated into the same spot in this one with Relocate.
+	void CloneFrom(const b2BlockAllocator& other);
+
+	/// Translate a pointer into the blocks of the allocator last cloned from. Null stays null.
+	template <class T>
+	T* Relocate(T* p) const
+	{
+		return static_cast<T*>(RelocateVoid(p));
+	}
+
+	/// Number of live allocations that bypassed the chunks.
+	int32 GetLargeAllocationCount() const { return m_largeAllocationCount; }
+
 	b2BlockAllocator& operator=(const b2BlockAllocator&) {
 		return *this;
 	}
 private:
+	void* RelocateVoid(const void* p) const;
 
 	b2Chunk* m_chunks;
 	int32 m_chunkCount;
@@ -58,6 +80,13 @@ private:
 
 	b2Block* m_freeLists[b2_blockSizes];
 
+	int32 m_largeAllocationCount;
+
+	/// Chunk base addresses of the allocator last cloned from, sorted, paired with the bases of our chunks.
+	b2ChunkRelocation* m_relocations;
+	int32 m_relocationCount;
+	int32 m_relocationSpace;
+
 #if DEBUG_PHYSICS_WORLD_CACHE_COPY
 public:
 	unsigned m_numAllocatedObjects;
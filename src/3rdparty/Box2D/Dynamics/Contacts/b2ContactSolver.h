@@ -26,6 +26,7 @@
 class b2Contact;
 class b2Body;
 class b2StackAllocator;
+class b2Island;
 struct b2ContactPositionConstraint;
 
 struct b2VelocityConstraintPoint
@@ -64,6 +65,7 @@ struct b2ContactSolverDef
 	b2Position* positions;
 	b2Velocity* velocities;
 	b2StackAllocator* allocator;
+	const b2Island* island;
 };
 
 class b2ContactSolver
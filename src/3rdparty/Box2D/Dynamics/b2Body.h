@@ -398,7 +398,11 @@ public:
 		e_bulletFlag		= 0x0008,
 		e_fixedRotationFlag	= 0x0010,
 		e_activeFlag		= 0x0020,
-		e_toiFlag			= 0x0040
+		e_toiFlag			= 0x0040,
+
+		// Not used by Box2D itself. Set by the owner once it has read back
+		// the final state of a body that went to sleep (see physics_system).
+		e_readBackFlag		= 0x0080
 	};
 
 	b2Body(const b2BodyDef* bd, b2World* world);
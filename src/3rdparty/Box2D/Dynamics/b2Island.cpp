@@ -160,6 +160,7 @@ b2Island::b2Island(
 	m_bodyCount = 0;
 	m_contactCount = 0;
 	m_jointCount = 0;
+	m_staticCount = 0;
 
 	m_allocator = allocator;
 	m_listener = listener;
@@ -170,11 +171,16 @@ b2Island::b2Island(
 
 	m_velocities = (b2Velocity*)m_allocator->Allocate(m_bodyCapacity * sizeof(b2Velocity));
 	m_positions = (b2Position*)m_allocator->Allocate(m_bodyCapacity * sizeof(b2Position));
+
+	m_staticBodies = (b2Body**)m_allocator->Allocate(m_bodyCapacity * sizeof(b2Body*));
+	m_staticIndices = (int32*)m_allocator->Allocate(m_bodyCapacity * sizeof(int32));
 }
 
 b2Island::~b2Island()
 {
 	// Warning: the order should reverse the constructor order.
+	m_allocator->Free(m_staticIndices);
+	m_allocator->Free(m_staticBodies);
 	m_allocator->Free(m_positions);
 	m_allocator->Free(m_velocities);
 	m_allocator->Free(m_joints);
@@ -182,7 +188,7 @@ b2Island::~b2Island()
 	m_allocator->Free(m_bodies);
 }
 
-void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& /* gravity */, bool allowSleep)
+bool b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& /* gravity */, bool allowSleep, b2ContactImpulse* impulses)
 {
 	b2Timer timer;
 
@@ -199,8 +205,12 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& /
 		float32 w = b->m_angularVelocity;
 
 		// Store positions for continuous collision.
-		b->m_sweep.c0 = b->m_sweep.c;
-		b->m_sweep.a0 = b->m_sweep.a;
+		// Static bodies never move, so theirs are already equal.
+		if (b->m_type != b2_staticBody)
+		{
+			b->m_sweep.c0 = b->m_sweep.c;
+			b->m_sweep.a0 = b->m_sweep.a;
+		}
 
 		if (b->m_type == b2_dynamicBody)
 		{
@@ -235,6 +245,7 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& /
 	solverData.step = step;
 	solverData.positions = m_positions;
 	solverData.velocities = m_velocities;
+	solverData.island = this;
 
 	// Initialize velocity constraints.
 	b2ContactSolverDef contactSolverDef;
@@ -244,6 +255,7 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& /
 	contactSolverDef.positions = m_positions;
 	contactSolverDef.velocities = m_velocities;
 	contactSolverDef.allocator = m_allocator;
+	contactSolverDef.island = this;
 
 	b2ContactSolver contactSolver(&contactSolverDef);
 	contactSolver.InitializeVelocityConstraints();
@@ -331,10 +343,17 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& /
 		}
 	}
 
-	// Copy state buffers back to the bodies
+	// Copy state buffers back to the bodies.
+	// Static bodies are skipped as their state could not have changed.
 	for (int32 i = 0; i < m_bodyCount; ++i)
 	{
 		b2Body* body = m_bodies[i];
+
+		if (body->m_type == b2_staticBody)
+		{
+			continue;
+		}
+
 		body->m_sweep.c = m_positions[i].c;
 		body->m_sweep.a = m_positions[i].a;
 		body->m_linearVelocity = m_velocities[i].v;
@@ -344,7 +363,7 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& /
 
 	profile->solvePosition = timer.GetMilliseconds();
 
-	Report(contactSolver.m_velocityConstraints);
+	StoreImpulses(contactSolver.m_velocityConstraints, impulses);
 
 	if (allowSleep)
 	{
@@ -375,15 +394,10 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& /
 			}
 		}
 
-		if (minSleepTime >= b2_timeToSleep && positionSolved)
-		{
-			for (int32 i = 0; i < m_bodyCount; ++i)
-			{
-				b2Body* b = m_bodies[i];
-				b->SetAwake(false);
-			}
-		}
+		return minSleepTime >= b2_timeToSleep && positionSolved;
 	}
+
+	return false;
 }
 
 void b2Island::SolveTOI(const b2TimeStep& subStep, int32 toiIndexA, int32 toiIndexB)
@@ -405,6 +419,7 @@ void b2Island::SolveTOI(const b2TimeStep& subStep, int32 toiIndexA, int32 toiInd
 	contactSolverDef.contacts = m_contacts;
 	contactSolverDef.count = m_contactCount;
 	contactSolverDef.allocator = m_allocator;
+	contactSolverDef.island = this;
 	contactSolverDef.step = subStep;
 	contactSolverDef.positions = m_positions;
 	contactSolverDef.velocities = m_velocities;
@@ -518,6 +533,22 @@ void b2Island::SolveTOI(const b2TimeStep& subStep, int32 toiIndexA, int32 toiInd
 	Report(contactSolver.m_velocityConstraints);
 }
 
+void b2Island::StoreImpulses(const b2ContactVelocityConstraint* constraints, b2ContactImpulse* impulses) const
+{
+	for (int32 i = 0; i < m_contactCount; ++i)
+	{
+		const b2ContactVelocityConstraint* vc = constraints + i;
+
+		b2ContactImpulse& impulse = impulses[i];
+		impulse.count = vc->pointCount;
+		for (int32 j = 0; j < vc->pointCount; ++j)
+		{
+			impulse.normalImpulses[j] = vc->points[j].normalImpulse;
+			impulse.tangentImpulses[j] = vc->points[j].tangentImpulse;
+		}
+	}
+}
+
 void b2Island::Report(const b2ContactVelocityConstraint* constraints)
 {
 	if (m_listener == NULL)
@@ -27,6 +27,7 @@ class b2Contact;
 class b2Joint;
 class b2StackAllocator;
 class b2ContactListener;
+struct b2ContactImpulse;
 struct b2ContactVelocityConstraint;
 struct b2Profile;
 
@@ -43,20 +44,59 @@ public:
 		m_bodyCount = 0;
 		m_contactCount = 0;
 		m_jointCount = 0;
+		m_staticCount = 0;
 	}
 
-	void Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& gravity, bool allowSleep);
+	/// Writes only to the bodies, contacts and joints of this island,
+	/// so independent islands can be solved concurrently.
+	/// Static bodies can be shared between islands, so they are only ever read.
+	/// The impulses are stored in the impulses array (one per contact) instead of being reported,
+	/// and the return value says whether the island should fall asleep.
+	/// Both are left to the caller, as the listener expects the bodies to still be awake.
+	bool Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& gravity, bool allowSleep, b2ContactImpulse* impulses);
 
 	void SolveTOI(const b2TimeStep& subStep, int32 toiIndexA, int32 toiIndexB);
 
 	void Add(b2Body* body)
 	{
 		b2Assert(m_bodyCount < m_bodyCapacity);
-		body->m_islandIndex = m_bodyCount;
+
+		if (body->m_type == b2_staticBody)
+		{
+			// A static body can be in many islands at once.
+			m_staticBodies[m_staticCount] = body;
+			m_staticIndices[m_staticCount] = m_bodyCount;
+			++m_staticCount;
+		}
+		else
+		{
+			body->m_islandIndex = m_bodyCount;
+		}
+
 		m_bodies[m_bodyCount] = body;
 		++m_bodyCount;
 	}
 
+	/// The index of the body in m_positions and m_velocities.
+	int32 GetIndexOf(const b2Body* body) const
+	{
+		if (body->m_type != b2_staticBody)
+		{
+			return body->m_islandIndex;
+		}
+
+		for (int32 i = 0; i < m_staticCount; ++i)
+		{
+			if (m_staticBodies[i] == body)
+			{
+				return m_staticIndices[i];
+			}
+		}
+
+		b2Assert(false);
+		return -1;
+	}
+
 	void Add(b2Contact* contact)
 	{
 		b2Assert(m_contactCount < m_contactCapacity);
@@ -70,6 +110,7 @@ public:
 	}
 
 	void Report(const b2ContactVelocityConstraint* constraints);
+	void StoreImpulses(const b2ContactVelocityConstraint* constraints, b2ContactImpulse* impulses) const;
 
 	b2StackAllocator* m_allocator;
 	b2ContactListener* m_listener;
@@ -78,12 +119,16 @@ public:
 	b2Contact** m_contacts;
 	b2Joint** m_joints;
 
+	b2Body** m_staticBodies;
+	int32* m_staticIndices;
+
 	b2Position* m_positions;
 	b2Velocity* m_velocities;
 
 	int32 m_bodyCount;
 	int32 m_jointCount;
 	int32 m_contactCount;
+	int32 m_staticCount;
 
 	int32 m_bodyCapacity;
 	int32 m_contactCapacity;
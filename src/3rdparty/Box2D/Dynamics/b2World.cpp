@@ -370,20 +370,91 @@ void b2World::SetAllowSleeping(bool flag)
 	}
 }
 
-// Find islands, integrate and solve constraints, solve position constraints
-void b2World::Solve(const b2TimeStep& step)
+// Islands are grouped into jobs of at least this many bodies, contacts and joints,
+// so that the cost of scheduling does not outweigh the cost of solving tiny islands.
+const int32 b2_minIslandJobCost = 128;
+
+// A range of the arrays that b2World::Solve gathers all islands into.
+struct b2IslandRange
+{
+	int32 bodyStart;
+	int32 bodyCount;
+	int32 contactStart;
+	int32 contactCount;
+	int32 jointStart;
+	int32 jointCount;
+
+	bool sleep;
+	b2Profile profile;
+};
+
+struct b2IslandJobs
+{
+	b2TimeStep step;
+	b2Vec2 gravity;
+	bool allowSleep;
+
+	b2Body** bodies;
+	b2Contact** contacts;
+	b2Joint** joints;
+	b2ContactImpulse* impulses;
+
+	b2IslandRange* islands;
+
+	// Job i solves the islands in [jobStarts[i], jobStarts[i + 1]).
+	int32* jobStarts;
+};
+
+static void b2SolveIsland(b2IslandJobs* jobs, int32 index, b2StackAllocator* allocator)
+{
+	b2IslandRange* range = jobs->islands + index;
+
+	b2Island island(range->bodyCount,
+					range->contactCount,
+					range->jointCount,
+					allocator,
+					NULL);
+
+	for (int32 i = 0; i < range->bodyCount; ++i)
+	{
+		island.Add(jobs->bodies[range->bodyStart + i]);
+	}
+	for (int32 i = 0; i < range->contactCount; ++i)
+	{
+		island.Add(jobs->contacts[range->contactStart + i]);
+	}
+	for (int32 i = 0; i < range->jointCount; ++i)
+	{
+		island.Add(jobs->joints[range->jointStart + i]);
+	}
+
+	range->sleep = island.Solve(&range->profile, jobs->step, jobs->gravity, jobs->allowSleep, jobs->impulses + range->contactStart);
+}
+
+static void b2SolveIslandJob(void* context, int32 index)
+{
+	b2IslandJobs* jobs = (b2IslandJobs*)context;
+
+	// The stack allocator is not thread-safe, so every thread gets its own.
+	static thread_local b2StackAllocator allocator;
+
+	for (int32 i = jobs->jobStarts[index]; i < jobs->jobStarts[index + 1]; ++i)
+	{
+		b2SolveIsland(jobs, i, &allocator);
+	}
+}
+
+// Find islands, integrate and solve constraints, solve position constraints.
+// All islands are found first, then solved (concurrently if there is an executor),
+// then reported and put to sleep in the order they were found in.
+// Islands never share anything other than static bodies, which they only read,
+// so the result does not depend on whether the islands were solved concurrently.
+void b2World::Solve(const b2TimeStep& step, b2JobExecutor* executor)
 {
 	m_profile.solveInit = 0.0f;
 	m_profile.solveVelocity = 0.0f;
 	m_profile.solvePosition = 0.0f;
 
-	// Size the island for the worst case.
-	b2Island island(m_bodyCount,
-					m_contactManager.m_contactCount,
-					m_jointCount,
-					&m_stackAllocator,
-					m_contactManager.m_contactListener);
-
 	// Clear all the island flags.
 	for (b2Body* b = m_bodyList; b; b = b->m_next)
 	{
@@ -398,7 +469,20 @@ void b2World::Solve(const b2TimeStep& step)
 		j->m_islandFlag = false;
 	}
 
-	// Build and simulate all awake islands.
+	// Size for the worst case. A static body can appear in as many islands
+	// as it has contacts and joints, every other body in at most one.
+	int32 bodyCapacity = m_bodyCount + m_contactManager.m_contactCount + m_jointCount;
+	b2Body** bodies = (b2Body**)m_stackAllocator.Allocate(bodyCapacity * sizeof(b2Body*));
+	b2Contact** contacts = (b2Contact**)m_stackAllocator.Allocate(m_contactManager.m_contactCount * sizeof(b2Contact*));
+	b2Joint** joints = (b2Joint**)m_stackAllocator.Allocate(m_jointCount * sizeof(b2Joint*));
+	b2IslandRange* islands = (b2IslandRange*)m_stackAllocator.Allocate(m_bodyCount * sizeof(b2IslandRange));
+
+	int32 bodyCount = 0;
+	int32 contactCount = 0;
+	int32 jointCount = 0;
+	int32 islandCount = 0;
+
+	// Build all awake islands.
 	int32 stackSize = m_bodyCount;
 	b2Body** stack = (b2Body**)m_stackAllocator.Allocate(stackSize * sizeof(b2Body*));
 	for (b2Body* seed = m_bodyList; seed; seed = seed->m_next)
@@ -419,8 +503,14 @@ void b2World::Solve(const b2TimeStep& step)
 			continue;
 		}
 
-		// Reset island and stack.
-		island.Clear();
+		b2IslandRange* island = islands + islandCount;
+		++islandCount;
+
+		island->bodyStart = bodyCount;
+		island->contactStart = contactCount;
+		island->jointStart = jointCount;
+
+		// Reset stack.
 		int32 stackCount = 0;
 		stack[stackCount++] = seed;
 		seed->m_flags |= b2Body::e_islandFlag;
@@ -431,7 +521,8 @@ void b2World::Solve(const b2TimeStep& step)
 			// Grab the next body off the stack and add it to the island.
 			b2Body* b = stack[--stackCount];
 			b2Assert(b->IsActive() == true);
-			island.Add(b);
+			b2Assert(bodyCount < bodyCapacity);
+			bodies[bodyCount++] = b;
 
 			// Make sure the body is awake.
 			b->SetAwake(true);
@@ -469,7 +560,7 @@ void b2World::Solve(const b2TimeStep& step)
 					continue;
 				}
 
-				island.Add(contact);
+				contacts[contactCount++] = contact;
 				contact->m_flags |= b2Contact::e_islandFlag;
 
 				b2Body* other = ce->other;
@@ -501,7 +592,7 @@ void b2World::Solve(const b2TimeStep& step)
 					continue;
 				}
 
-				island.Add(je->joint);
+				joints[jointCount++] = je->joint;
 				je->joint->m_islandFlag = true;
 
 				if (other->m_flags & b2Body::e_islandFlag)
@@ -515,17 +606,14 @@ void b2World::Solve(const b2TimeStep& step)
 			}
 		}
 
-		b2Profile profile;
-		island.Solve(&profile, step, m_gravity, m_allowSleep);
-		m_profile.solveInit += profile.solveInit;
-		m_profile.solveVelocity += profile.solveVelocity;
-		m_profile.solvePosition += profile.solvePosition;
+		island->bodyCount = bodyCount - island->bodyStart;
+		island->contactCount = contactCount - island->contactStart;
+		island->jointCount = jointCount - island->jointStart;
 
-		// Post solve cleanup.
-		for (int32 i = 0; i < island.m_bodyCount; ++i)
+		for (int32 i = island->bodyStart; i < bodyCount; ++i)
 		{
 			// Allow static bodies to participate in other islands.
-			b2Body* b = island.m_bodies[i];
+			b2Body* b = bodies[i];
 			if (b->GetType() == b2_staticBody)
 			{
 				b->m_flags &= ~b2Body::e_islandFlag;
@@ -535,6 +623,88 @@ void b2World::Solve(const b2TimeStep& step)
 
 	m_stackAllocator.Free(stack);
 
+	b2IslandJobs jobs;
+	jobs.step = step;
+	jobs.gravity = m_gravity;
+	jobs.allowSleep = m_allowSleep;
+	jobs.bodies = bodies;
+	jobs.contacts = contacts;
+	jobs.joints = joints;
+	jobs.impulses = (b2ContactImpulse*)m_stackAllocator.Allocate(contactCount * sizeof(b2ContactImpulse));
+	jobs.islands = islands;
+	jobs.jobStarts = (int32*)m_stackAllocator.Allocate((islandCount + 1) * sizeof(int32));
+
+	// Split the islands into consecutive runs of similar cost.
+	int32 jobCount = 0;
+	if (executor != NULL)
+	{
+		int32 targetJobCount = 4 * b2Max(executor->GetConcurrency(), 1);
+		int32 jobCost = b2Max(b2_minIslandJobCost, (bodyCount + contactCount + jointCount) / targetJobCount);
+		int32 cost = 0;
+
+		jobs.jobStarts[0] = 0;
+		for (int32 i = 0; i < islandCount; ++i)
+		{
+			cost += islands[i].bodyCount + islands[i].contactCount + islands[i].jointCount;
+
+			if (cost >= jobCost || i == islandCount - 1)
+			{
+				jobs.jobStarts[++jobCount] = i + 1;
+				cost = 0;
+			}
+		}
+	}
+
+	if (jobCount > 1)
+	{
+		executor->ParallelFor(jobCount, b2SolveIslandJob, &jobs);
+	}
+	else
+	{
+		for (int32 i = 0; i < islandCount; ++i)
+		{
+			b2SolveIsland(&jobs, i, &m_stackAllocator);
+		}
+	}
+
+	// Report the impulses and put the islands to sleep, as if they were solved one after another.
+	b2ContactListener* listener = m_contactManager.m_contactListener;
+	for (int32 i = 0; i < islandCount; ++i)
+	{
+		const b2IslandRange* island = islands + i;
+
+		m_profile.solveInit += island->profile.solveInit;
+		m_profile.solveVelocity += island->profile.solveVelocity;
+		m_profile.solvePosition += island->profile.solvePosition;
+
+		if (listener != NULL)
+		{
+			for (int32 j = island->contactStart; j < island->contactStart + island->contactCount; ++j)
+			{
+				listener->PostSolve(contacts[j], jobs.impulses + j);
+			}
+		}
+
+		if (island->sleep)
+		{
+			for (int32 j = island->bodyStart; j < island->bodyStart + island->bodyCount; ++j)
+			{
+				b2Body* b = bodies[j];
+				if (b->GetType() != b2_staticBody)
+				{
+					b->SetAwake(false);
+				}
+			}
+		}
+	}
+
+	m_stackAllocator.Free(jobs.jobStarts);
+	m_stackAllocator.Free(jobs.impulses);
+	m_stackAllocator.Free(islands);
+	m_stackAllocator.Free(joints);
+	m_stackAllocator.Free(contacts);
+	m_stackAllocator.Free(bodies);
+
 	{
 		b2Timer timer;
 		// Synchronize fixtures, check for out of range bodies.
@@ -848,7 +1018,7 @@ void b2World::SolveTOI(const b2TimeStep& step)
 		subStep.positionIterations = 20;
 		subStep.velocityIterations = step.velocityIterations;
 		subStep.warmStarting = false;
-		island.SolveTOI(subStep, bA->m_islandIndex, bB->m_islandIndex);
+		island.SolveTOI(subStep, island.GetIndexOf(bA), island.GetIndexOf(bB));
 
 		// Reset island flags and synchronize broad-phase proxies.
 		for (int32 i = 0; i < island.m_bodyCount; ++i)
@@ -882,7 +1052,7 @@ void b2World::SolveTOI(const b2TimeStep& step)
 	}
 }
 
-void b2World::Step(float32 dt, int32 velocityIterations, int32 positionIterations)
+void b2World::Step(float32 dt, int32 velocityIterations, int32 positionIterations, b2JobExecutor* executor)
 {
 	b2Timer stepTimer;
 
@@ -923,7 +1093,7 @@ void b2World::Step(float32 dt, int32 velocityIterations, int32 positionIteration
 	if (m_stepComplete && step.dt > 0.0f)
 	{
 		b2Timer timer;
-		Solve(step);
+		Solve(step, executor);
 		m_profile.solve = timer.GetMilliseconds();
 	}
 
@@ -90,9 +90,13 @@ public:
 	/// @param timeStep the amount of time to simulate, this should not vary.
 	/// @param velocityIterations for the velocity constraint solver.
 	/// @param positionIterations for the position constraint solver.
+	/// @param executor if set, independent islands are solved concurrently on it.
+	/// The results are bit-identical to those of a step without an executor,
+	/// and the contact listener is still called from the calling thread, in the same order.
 	void Step(	float32 timeStep,
 				int32 velocityIterations,
-				int32 positionIterations);
+				int32 positionIterations,
+				b2JobExecutor* executor = NULL);
 
 	/// Manually clear the force buffer on all bodies. By default, forces are cleared automatically
 	/// after each call to Step. The default behavior is modified by calling SetAutoClearForces.
@@ -228,7 +232,7 @@ public:
 	friend class b2ContactManager;
 	friend class b2Controller;
 
-	void Solve(const b2TimeStep& step);
+	void Solve(const b2TimeStep& step, b2JobExecutor* executor);
 	void SolveTOI(const b2TimeStep& step);
 
 	void DrawJoint(b2Joint* joint);
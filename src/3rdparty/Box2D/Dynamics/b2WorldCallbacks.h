@@ -158,4 +158,19 @@ public:
 									const b2Vec2& normal, float32 fraction) = 0;
 };
 
+/// Runs independent jobs concurrently, e.g. on a thread pool.
+/// See b2World::Step
+class b2JobExecutor
+{
+public:
+	virtual ~b2JobExecutor() {}
+
+	/// How many jobs can run at the same time.
+	virtual int32 GetConcurrency() const = 0;
+
+	/// Call job(context, i) for every i in [0, count) and return once all of these calls have finished.
+	/// The calls can happen in any order and on any threads.
+	virtual void ParallelFor(int32 count, void (*job)(void* context, int32 index), void* context) = 0;
+};
+
 #endif
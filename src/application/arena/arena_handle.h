@@ -4,7 +4,9 @@
 #include "application/arena/mode_and_rules.h"
 
 #include "application/arena/arena_utils.h"
+#include "game/modes/round_template.h"
 #include "test_scenes/test_scene_settings.h"
+#include "game/detail/pathfinding/bake_navmesh.h"
 #include "view/game_drawing_settings.h"
 
 struct arena_paths;
@@ -30,7 +32,7 @@ class basic_arena_handle {
 				ensure(vars != nullptr);
 
 				if constexpr(M::needs_initial_signi) {
-					const auto in = I { *vars, self.initial_signi, self.advanced_cosm };
+					const auto in = I { *vars, self.initial_signi, self.advanced_cosm, self.round_start_template };
 
 					return callback(typed_mode, in);
 				}
@@ -65,6 +67,13 @@ public:
 	maybe_const_ref_t<C, cosmos> advanced_cosm;
 	maybe_const_ref_t<C, predefined_rulesets> rulesets;
 	const cosmos_solvable_significant& initial_signi;
+	maybe_const_ptr_t<C, round_template> round_start_template = nullptr;
+
+	void invalidate_round_start_template() const {
+		if (round_start_template != nullptr) {
+			round_start_template->invalidate();
+		}
+	}
 
 	template <class T>
 	void transfer_all_solvables(T& from) {
@@ -72,6 +81,14 @@ public:
 		current_mode = from.current_mode;
 	}
 
+	/* Only for arenas that have been in sync since they last transferred all solvables. */
+
+	template <class T>
+	void transfer_solvables_changing_in_game(T& from) {
+		advanced_cosm.assign_solvable_changing_in_game(from.advanced_cosm);
+		current_mode = from.current_mode;
+	}
+
 	template <class... Args>
 	decltype(auto) on_mode_with_input(Args&&... args) const {
 		return this->on_mode_with_input_impl(*this, std::forward<Args>(args)...);
@@ -135,15 +152,18 @@ public:
 
 	void load_from(
 		const arena_paths& paths,
-		cosmos_solvable_significant& target_initial_signi
+		cosmos_solvable_significant& target_initial_signi,
+		reinferred_intercosm_cache* const reinferred_cache = nullptr
 	) const {
 		load_arena_from(
 			paths,
 			scene,
-			rulesets
+			rulesets,
+			reinferred_cache
 		);
 
 		target_initial_signi = advanced_cosm.get_solvable().significant;
+		invalidate_round_start_template();
 	}
 
 	template <class S>
@@ -188,7 +208,10 @@ public:
 		rulesets.meta.server_default = id;
 		rulesets.meta.playtest_default = id;
 
+		::bake_navmesh_if_necessary(scene.world);
+
 		target_initial_signi = advanced_cosm.get_solvable().significant;
+		invalidate_round_start_template();
 	}
 
 	template <class... Args>
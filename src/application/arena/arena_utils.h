@@ -8,11 +8,13 @@ namespace sol {
 struct intercosm;
 struct predefined_rulesets;
 struct arena_paths;
+class reinferred_intercosm_cache;
 
 void load_arena_from(
 	const arena_paths& paths,
 	intercosm& scene,
-	predefined_rulesets& rulesets
+	predefined_rulesets& rulesets,
+	reinferred_intercosm_cache* = nullptr
 );
 
 void make_test_online_arena(
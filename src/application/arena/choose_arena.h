@@ -6,7 +6,8 @@ inline void choose_arena(
 	sol::state& lua,
 	online_arena_handle<false> handle,
 	const server_solvable_vars& vars,
-	cosmos_solvable_significant& initial_signi
+	cosmos_solvable_significant& initial_signi,
+	reinferred_intercosm_cache* const reinferred_cache = nullptr
 ) {
 	const auto& name = vars.current_arena;
 	const auto emigrated_session = handle.on_mode([](const auto& typed_mode) { return typed_mode.emigrate(); });
@@ -25,7 +26,8 @@ inline void choose_arena(
 
 		handle.load_from(
 			paths,
-			initial_signi
+			initial_signi,
+			reinferred_cache
 		);
 	}
 
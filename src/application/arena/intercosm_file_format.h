@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+
+#include "augs/readwrite/byte_readwrite.h"
+#include "augs/readwrite/stream_read_error.h"
+
+/*
+	The .comm and .solv files of an arena begin with a magic number and the version of their layout,
+	so that a change to the layout of the cosmos is not mistaken for the state itself.
+
+	Arenas saved before the header was introduced (e.g. the official arenas of 2020)
+	begin right away with the state. They are read as LEGACY and migrated to the current layout.
+*/
+
+enum class intercosm_file_version : uint32_t {
+	LEGACY = 0,
+	/*
+		Hot components of characters are stored in the synchronized arrays of their pool,
+		characters have components::pathfinding and components::behaviour_tree,
+		and the common state holds the navmesh.
+	*/
+	HOT_COMPONENTS,
+
+	COUNT
+};
+
+constexpr auto intercosm_current_file_version = static_cast<intercosm_file_version>(
+	static_cast<uint32_t>(intercosm_file_version::COUNT) - 1
+);
+
+/* "HYPCOSM" followed by a zero, as little endian. */
+constexpr uint64_t intercosm_file_magic = 0x004d534f43505948ull;
+
+template <class Archive>
+void write_intercosm_file_header(Archive& ar) {
+	augs::write_bytes(ar, intercosm_file_magic);
+	augs::write_bytes(ar, static_cast<uint32_t>(intercosm_current_file_version));
+}
+
+/*
+	Leaves the stream right after the header,
+	or where it was if the file has none.
+*/
+
+template <class Archive>
+intercosm_file_version read_intercosm_file_version(Archive& ar) {
+	const auto start = ar.get_read_pos();
+
+	if (ar.get_unread_bytes() >= sizeof(intercosm_file_magic)) {
+		uint64_t magic = 0;
+		augs::read_bytes(ar, magic);
+
+		if (magic == intercosm_file_magic) {
+			uint32_t version = 0;
+			augs::read_bytes(ar, version);
+
+			if (version == 0 || version > static_cast<uint32_t>(intercosm_current_file_version)) {
+				throw augs::stream_read_error(
+					"The arena was saved in an unknown format (version %x). The game supports versions up to %x.",
+					version,
+					static_cast<uint32_t>(intercosm_current_file_version)
+				);
+			}
+
+			return static_cast<intercosm_file_version>(version);
+		}
+	}
+
+	ar.set_read_pos(start);
+	return intercosm_file_version::LEGACY;
+}
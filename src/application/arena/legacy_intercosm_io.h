@@ -0,0 +1,125 @@
+#pragma once
+#include "augs/templates/for_each_std_get.h"
+#include "augs/misc/pool/pool_io.hpp"
+#include "augs/readwrite/byte_readwrite.h"
+
+#include "game/cosmos/cosmos_solvable_significant.h"
+#include "game/cosmos/cosmos_common_significant.h"
+#include "game/cosmos/hot_component.h"
+
+/*
+	Layouts of the state as the arenas of intercosm_file_version::LEGACY were saved,
+	and the readers that migrate them to the current layout.
+*/
+
+namespace legacy_intercosm {
+	/*
+		Characters kept all of their components in entity_solvable, in this order.
+	*/
+
+	using character_component_list = type_list<
+		components::rigid_body,
+		components::movement,
+
+		components::item_slot_transfers,
+		components::melee_fighter,
+		components::crosshair,
+		components::sentience,
+
+		components::driver,
+		components::attitude,
+		components::head
+	>;
+
+	struct character_solvable : entity_solvable_meta {
+		replace_list_type_t<character_component_list, augs::trivially_copyable_tuple> component_state;
+	};
+
+	static_assert(std::is_trivially_copyable_v<character_solvable>, "Legacy characters are read as raw memory.");
+
+	template <class Archive>
+	void read_character_pool(Archive& ar, make_entity_pool<controlled_character>& pool) {
+		using E = controlled_character;
+
+		pool.template read_migrated_object_bytes<character_solvable>(
+			ar,
+			[&pool](const character_solvable& legacy, entity_solvable<E>& migrated, const auto index) {
+				static_cast<entity_solvable_meta&>(migrated) = legacy;
+
+				for_each_through_std_get(
+					legacy.component_state,
+					[&](const auto& component) {
+						using C = remove_cref<decltype(component)>;
+
+						if constexpr(is_hot_component_v<E, C>) {
+							static_cast<C&>(pool.template get_corresponding_array<hot_component<C>>()[index]) = component;
+						}
+						else {
+							migrated.template get<C>() = component;
+						}
+					}
+				);
+			}
+		);
+	}
+
+	template <class Archive>
+	void read_solvable(Archive& ar, cosmos_solvable_significant& significant) {
+		augs::introspect(
+			[&](auto, auto& member) {
+				using M = remove_cref<decltype(member)>;
+
+				if constexpr(std::is_same_v<M, all_entity_pools>) {
+					significant.for_each_entity_pool(
+						[&](auto& pool) {
+							using P = remove_cref<decltype(pool)>;
+							using E = typename P::mapped_type::used_entity_type;
+
+							if constexpr(std::is_same_v<E, controlled_character>) {
+								read_character_pool(ar, pool);
+							}
+							else {
+								augs::read_bytes(ar, pool);
+							}
+						}
+					);
+				}
+				else {
+					augs::read_bytes(ar, member);
+				}
+			},
+			significant
+		);
+	}
+
+	/*
+		Before the navmesh, the pathfinding settings were those of the visibility graph pathfinding.
+		They meant nothing to the navmesh, so the current settings keep their defaults.
+	*/
+
+	struct pathfinding_settings {
+		float epsilon_distance_visible_point = 2.f;
+		float epsilon_distance_the_same_vertex = 50.f;
+	};
+
+	template <class Archive>
+	void read_common(Archive& ar, cosmos_common_significant& common) {
+		augs::introspect(
+			[&](auto, auto& member) {
+				using M = remove_cref<decltype(member)>;
+
+				if constexpr(std::is_same_v<M, ::pathfinding_settings>) {
+					legacy_intercosm::pathfinding_settings legacy;
+					augs::read_bytes(ar, legacy);
+				}
+				else if constexpr(std::is_same_v<M, navigation_mesh>) {
+					/* Baked once the arena is loaded. */
+				}
+				else {
+					augs::read_bytes(ar, member);
+				}
+			},
+			common
+		);
+	}
+}
@@ -1321,6 +1321,15 @@ void settings_gui_state::perform(
 					revertable_slider(SCOPE_CFG_NVP(snapshot_interval_in_steps), 400u, 5000u);
 				}
 
+				if (auto node = scoped_tree_node("History")) {
+					auto& scope_cfg = config.editor.history_checkpoints;
+
+					text_disabled("(Interval of 0 disables the checkpoints)");
+
+					revertable_slider(SCOPE_CFG_NVP(interval_in_revisions), 0u, 500u);
+					revertable_slider(SCOPE_CFG_NVP(memory_budget_in_megabytes), 16u, 4096u);
+				}
+
 				if (auto node = scoped_tree_node("Debug")) {
 					auto& scope_cfg = config.editor;
 
@@ -1516,6 +1525,7 @@ void settings_gui_state::perform(
 
 					revertable_slider(SCOPE_CFG_NVP(atlas_blitting_threads), 1u, t_max);
 					revertable_slider(SCOPE_CFG_NVP(neon_regeneration_threads), 1u, t_max);
+					revertable_slider(SCOPE_CFG_NVP(sound_decoding_threads), 1u, t_max);
 				}
 
 				ImGui::Separator();
@@ -1677,7 +1687,11 @@ void do_server_vars(
 
 	ImGui::Separator();
 
-	revertable_slider(SCOPE_CFG_NVP(sleep_mult), 0.0f, 0.9f);
+	revertable_checkbox(SCOPE_CFG_NVP(precise_tick_scheduler));
+
+	if (!scope_cfg.precise_tick_scheduler) {
+		revertable_slider(SCOPE_CFG_NVP(sleep_mult), 0.0f, 0.9f);
+	}
 }
 
 #undef CONFIG_NVP
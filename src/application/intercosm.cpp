@@ -1,4 +1,5 @@
 #include "application/intercosm.h"
+#include "application/reinferred_intercosm_cache.h"
 #include "game/cosmos/cosmic_functions.h"
 #include "application/intercosm_io.hpp"
 
@@ -18,6 +19,14 @@
 
 #include "augs/readwrite/lua_file.h"
 #include "augs/readwrite/byte_file.h"
+#include "augs/readwrite/hashing_stream.h"
+#include "augs/filesystem/mapped_file.h"
+#include "augs/templates/thread_templates.h"
+#include "augs/templates/container_templates.h"
+
+#include "application/arena/intercosm_file_format.h"
+#include "application/arena/legacy_intercosm_io.h"
+#include "game/detail/pathfinding/bake_navmesh.h"
 
 #include "game/modes/bomb_defusal.h"
 #include "game/modes/test_mode.h"
@@ -131,24 +140,128 @@ void intercosm::load_from_lua(const intercosm_path_op op) {
 
 void intercosm::save_as_bytes(const intercosm_paths& paths) const {
 	augs::save_as_bytes(viewables, paths.viewables_file);
-	augs::save_as_bytes(world.get_common_significant(), paths.comm_file);
-	augs::save_as_bytes(world.get_solvable().significant, paths.solv_file);
+
+	{
+		auto out = augs::open_binary_output_stream(paths.comm_file);
+		::write_intercosm_file_header(out);
+		augs::write_bytes(out, world.get_common_significant());
+	}
+
+	{
+		auto out = augs::open_binary_output_stream(paths.solv_file);
+		::write_intercosm_file_header(out);
+		augs::write_bytes(out, world.get_solvable().significant);
+	}
+}
+
+static bool flavour_ids_enabled(const intercosm& i) {
+	return i.world.get_solvable_inferred().flavour_ids.enabled;
 }
 
-void intercosm::load_from_bytes(const intercosm_paths& paths) {
-	augs::load_from_bytes(viewables, paths.viewables_file);
+reinferred_intercosm_cache::reinferred_intercosm_cache() = default;
+reinferred_intercosm_cache::~reinferred_intercosm_cache() = default;
 
-	world.change_common_significant([&](cosmos_common_significant& common) {
-		augs::load_from_bytes(common, paths.comm_file);
-		return changer_callback_result::DONT_REFRESH;
+bool reinferred_intercosm_cache::copy_if_found(const uint64_t hash, intercosm& into) const {
+	for (auto& e : entries) {
+		/* The flavour id cache is inferred only if enabled, so it must match what the caller expects. */
+
+		if (e.first == hash && flavour_ids_enabled(*e.second) == flavour_ids_enabled(into)) {
+			into.viewables = e.second->viewables;
+			into.world = e.second->world;
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void reinferred_intercosm_cache::remember(const uint64_t hash, const intercosm& loaded) {
+	erase_if(entries, [hash](const auto& e) { return e.first == hash; });
+
+	if (entries.size() >= max_entries) {
+		entries.erase(entries.begin());
+	}
+
+	auto& copy = entries.emplace_back(hash, std::make_unique<intercosm>()).second;
+	copy->viewables = loaded.viewables;
+	copy->world = loaded.world;
+}
+
+void intercosm::load_from_bytes(const intercosm_paths& paths, reinferred_intercosm_cache* const reinferred_cache) {
+	const auto viewables_file = augs::mapped_file(paths.viewables_file);
+	const auto comm_file = augs::mapped_file(paths.comm_file);
+	const auto solv_file = augs::mapped_file(paths.solv_file);
+
+	const auto contents_hash = [&]() -> uint64_t {
+		if (reinferred_cache == nullptr) {
+			return 0;
+		}
+
+		augs::hashing_stream h;
+
+		for (const auto* f : { &viewables_file, &comm_file, &solv_file }) {
+			augs::write_bytes(h, static_cast<uint64_t>(f->size()));
+			h.write(f->data(), f->size());
+		}
+
+		return h.get_hash();
+	}();
+
+	if (reinferred_cache && reinferred_cache->copy_if_found(contents_hash, *this)) {
+		world.request_resample();
+		return;
+	}
+
+	/* 
+		The three parts do not depend on one another, so they are read at the same time.
+		Not refreshing leaves the world untouched outside of the part being read.
+	*/
+
+	auto read_viewables = launch_async([&]() {
+		auto s = viewables_file.make_read_stream();
+		augs::read_bytes(s, viewables);
+	});
+
+	auto read_common = launch_async([&]() {
+		world.change_common_significant([&](cosmos_common_significant& common) {
+			auto s = comm_file.make_read_stream();
+
+			if (::read_intercosm_file_version(s) == intercosm_file_version::LEGACY) {
+				legacy_intercosm::read_common(s, common);
+			}
+			else {
+				augs::read_bytes(s, common);
+			}
+
+			return changer_callback_result::DONT_REFRESH;
+		});
 	});
 
 	cosmic::change_solvable_significant(world, [&](cosmos_solvable_significant& significant) {
-		augs::load_from_bytes(significant, paths.solv_file);
+		auto s = solv_file.make_read_stream();
+
+		if (::read_intercosm_file_version(s) == intercosm_file_version::LEGACY) {
+			legacy_intercosm::read_solvable(s, significant);
+		}
+		else {
+			augs::read_bytes(s, significant);
+		}
+
 		return changer_callback_result::DONT_REFRESH;
 	});
 
+	read_viewables.get();
+	read_common.get();
+
 	post_load_state_correction();
+
+	/* Needs the physics world, hence only after reinference. */
+	::bake_navmesh_if_necessary(world);
+
+	if (reinferred_cache) {
+		reinferred_cache->remember(contents_hash, *this);
+	}
 }
 
 void intercosm::update_offsets_of(const assets::image_id& id, const changer_callback_result result) {
@@ -15,6 +15,7 @@ struct intercosm_path_op {
 };
 
 struct test_scene_settings;
+class reinferred_intercosm_cache;
 
 struct test_mode_ruleset;
 struct bomb_defusal_ruleset;
@@ -37,7 +38,7 @@ struct intercosm {
 		bomb_defusal_ruleset* = nullptr
 	);
 
-	void load_from_bytes(const intercosm_paths&);
+	void load_from_bytes(const intercosm_paths&, reinferred_intercosm_cache* = nullptr);
 	void save_as_bytes(const intercosm_paths&) const;
 
 	void load_from_lua(const intercosm_path_op);
@@ -39,6 +39,16 @@ struct all_game_renderers {
 
 		return total;
 	}
+
+	std::size_t extract_num_total_drawcalls() {
+		std::size_t total = 0;
+
+		for (auto& a : all) {
+			total += a.extract_num_total_drawcalls();
+		}
+
+		return total;
+	}
 };
 
 struct game_frame_buffer {
@@ -6,6 +6,7 @@
 #include "augs/templates/logically_empty.h"
 #include "application/network/net_serialization_helpers.h"
 #include "application/network/net_solvable_stream.h"
+#include "application/network/preserialized_initial_arena_state.h"
 
 #include "augs/window_framework/mouse_rel_bound.h"
 
@@ -13,6 +14,7 @@ template <bool C>
 struct initial_arena_state_payload {
 	maybe_const_ref_t<C, cosmos_solvable_significant> signi;
 	maybe_const_ref_t<C, online_mode_and_rules> mode;
+	maybe_const_ref_t<C, std::vector<server_step_entropy>> steps_since_sync;
 	maybe_const_ref_t<C, uint32_t> client_id;
 	maybe_const_ref_t<C, rcon_level_type> rcon;
 };
@@ -47,6 +49,13 @@ constexpr std::size_t max_server_step_size_v =
 	- yojimbo::ConservativeMessageHeaderBits / 8
 ;
 
+/* 
+	Leaves room for the trailing context byte, 
+	and stays a multiple of 4 as required by the bit writer.
+*/
+
+constexpr std::size_t max_shared_server_step_size_v = max_server_step_size_v - 4;
+
 namespace net_messages {
 	template <class Stream>
 	bool serialize(Stream& s, total_mode_player_entropy& p) {
@@ -213,21 +222,17 @@ namespace net_messages {
 		auto& i = total_networked.payload;
 		auto& g = i.general;
 
-#if !CONTEXTS_SEPARATE
-		if (!serialize(s, total_networked.context)) {
-			return false;
-		}
-#endif
+		/* The context differs per client, so it is written separately by the message itself. */
 
-		auto& state_hash = total_networked.meta.state_hash;
-		bool has_state_hash = logically_set(state_hash);
+		auto& state_digest = total_networked.meta.state_digest;
+		bool has_state_digest = logically_set(state_digest);
 
 		bool has_players = logically_set(i.players);
 		bool has_added_player = logically_set(g.added_player);
 		bool has_removed_player = logically_set(g.removed_player);
 		bool has_special_command = logically_set(g.special_command);
 
-		serialize_bool(s, has_state_hash);
+		serialize_bool(s, has_state_digest);
 		serialize_bool(s, has_players);
 		serialize_bool(s, has_added_player);
 		serialize_bool(s, has_removed_player);
@@ -237,15 +242,23 @@ namespace net_messages {
 
 		serialize_align(s);
 
-		if (has_state_hash) {
-			if (state_hash == std::nullopt) {
-				state_hash.emplace();
+		if (has_state_digest) {
+			if (state_digest == std::nullopt) {
+				state_digest.emplace();
 			}
 
-			serialize_uint32(s, *state_hash);
+			auto& d = *state_digest;
+
+			serialize_uint64(s, d.clock);
+			serialize_uint64(s, d.specific_names);
+			serialize_uint64(s, d.global);
+
+			for (auto& p : d.pools) {
+				serialize_uint64(s, p);
+			}
 		}
 		else {
-			state_hash = std::nullopt;
+			state_digest = std::nullopt;
 		}
 
 		if (has_players) {
@@ -322,13 +335,62 @@ namespace net_messages {
 	}
 #endif
 
+	/*
+		The context is the single trailing byte of the message,
+		so that the rest - identical for every client - is serialized once per step
+		and only copied into the message of each client.
+	*/
+
+	inline bool preserialize_server_step_entropy(
+		preserialized_server_step_entropy& output,
+		::networked_server_step_entropy& input
+	) {
+		output.bytes.resize(max_shared_server_step_size_v);
+		return safe_write(output.bytes, input);
+	}
+
 	inline bool server_step_entropy::read_payload(::networked_server_step_entropy& output) {
-		return safe_read(bytes, output);
+		auto shared_size = bytes.size();
+
+#if !CONTEXTS_SEPARATE
+		if (shared_size == 0 || shared_size > max_shared_server_step_size_v + 1) {
+			return false;
+		}
+
+		output.context.num_entropies_accepted = static_cast<uint8_t>(bytes.back());
+		--shared_size;
+#endif
+
+		auto s = yojimbo::ReadStream(yojimbo::GetDefaultAllocator(), (const uint8_t*)bytes.data(), shared_size);
+		return serialize(s, output);
+	}
+
+	inline bool server_step_entropy::write_payload(
+		const preserialized_server_step_entropy& shared,
+		const ::prestep_client_context& context
+	) {
+		const auto shared_size = shared.bytes.size();
+
+		bytes.resize_no_init(shared_size);
+		std::memcpy(bytes.data(), shared.bytes.data(), shared_size);
+
+#if !CONTEXTS_SEPARATE
+		bytes.push_back(static_cast<std::byte>(context.num_entropies_accepted));
+#else
+		(void)context;
+#endif
+
+		return true;
 	}
 
 	inline bool server_step_entropy::write_payload(::networked_server_step_entropy& input) {
-		bytes.resize(max_server_step_size_v);
-		return safe_write(bytes, input);
+		preserialized_server_step_entropy shared;
+
+		if (!preserialize_server_step_entropy(shared, input)) {
+			return false;
+		}
+
+		return write_payload(shared, input.context);
 	}
 
 	inline bool client_entropy::read_payload(
@@ -519,6 +581,19 @@ namespace net_messages {
 		return true;
 	}
 
+	/*
+		The block begins with a fixed-size header:
+		the uncompressed size, the client id and the rcon level.
+		What follows is shared by all clients joining in the same step:
+		the compressed solvable and mode at the sync point, and the entropies of all steps since.
+	*/
+
+	constexpr std::size_t initial_arena_state_header_size_v = 
+		sizeof(uint32_t) 
+		+ sizeof(uint32_t) 
+		+ sizeof(rcon_level_type)
+	;
+
 	inline bool initial_arena_state::read_payload(
 		augs::serialization_buffers& buffers,
 		const cosmos_solvable_significant& initial_signi,
@@ -531,13 +606,25 @@ namespace net_messages {
 
 		NSR_LOG("Compressed stream size: %x", size);
 
-		const bool size_written_properly = size >= sizeof(uint32_t);
+		const bool header_written_properly = size >= initial_arena_state_header_size_v;
 
-		if (!size_written_properly) {
+		if (!header_written_properly) {
 			return false;
 		}
 
-		const auto uncompressed_size = *reinterpret_cast<const uint32_t*>(data);
+		uint32_t uncompressed_size = 0;
+
+		{
+			auto h = data;
+
+			std::memcpy(&uncompressed_size, h, sizeof(uint32_t));
+			h += sizeof(uint32_t);
+
+			std::memcpy(&in.client_id, h, sizeof(uint32_t));
+			h += sizeof(uint32_t);
+
+			std::memcpy(&in.rcon, h, sizeof(rcon_level_type));
+		}
 	
 		NSR_LOG("Uncompressed size: %x", uncompressed_size);
 
@@ -554,8 +641,8 @@ namespace net_messages {
 
 		try {
 			augs::decompress(
-				data + sizeof(uint32_t),
-				size - sizeof(uint32_t),
+				data + initial_arena_state_header_size_v,
+				size - initial_arena_state_header_size_v,
 				uncompressed_buf
 			);
 
@@ -572,70 +659,104 @@ namespace net_messages {
 
 		augs::read_bytes(s, in.signi);
 		augs::read_bytes(s, in.mode);
-		augs::read_bytes(s, in.client_id);
-		augs::read_bytes(s, in.rcon);
+		augs::read_bytes(s, in.steps_since_sync);
 
 		NSR_LOG_NVPS(in.client_id);
+		NSR_LOG("Steps since sync: %x", in.steps_since_sync.size());
 
 		return true;
 	}
 
-	template <class F>
-	inline bool initial_arena_state::write_payload(
-		F block_allocator,
-		augs::serialization_buffers& buffers,
+	inline void serialize_initial_arena_state(
+		std::vector<std::byte>& output,
 		const cosmos_solvable_significant& initial_signi,
 		const all_entity_flavours& all_flavours,
-		const initial_arena_state_payload<true> in
+		const cosmos_solvable_significant& signi,
+		const online_mode_and_rules& mode
 	) {
-		auto write_all_to = [&in](auto& s) {
-			augs::write_bytes(s, in.signi);
-			augs::write_bytes(s, in.mode);
-			augs::write_bytes(s, in.client_id);
-			augs::write_bytes(s, in.rcon);
+		auto write_all_to = [&](auto& s) {
+			augs::write_bytes(s, signi);
+			augs::write_bytes(s, mode);
 		};
 
-		NSR_LOG("SENDING INITIAL STATE");
+		NSR_LOG("SERIALIZING INITIAL STATE");
 
-		{
-			NSR_LOG("STAGE: ESTIMATION");
+		augs::byte_counter_stream counter;
+		write_all_to(counter);
 
-			augs::byte_counter_stream s;
+		output.clear();
+		output.reserve(counter.size());
+
+		NSR_LOG("Reserved size: %x", counter.size());
+
+		{
+			auto s = net_solvable_stream_ref(all_flavours, initial_signi, signi, output);
 			write_all_to(s);
-			buffers.serialization.reserve(s.size());
+		}
 
-			NSR_LOG("Reserved size: %x", s.size());
+		NSR_LOG("Result stream length: %x", output.size());
+	}
 
-			{
-				auto s = buffers.make_serialization_stream<net_solvable_stream_ref>(all_flavours, initial_signi, in.signi);
-				write_all_to(s);
-			}
+	inline void preserialize_initial_arena_state(
+		preserialized_initial_arena_state& output,
+		augs::serialization_buffers& buffers,
+		const join_sync_point& from
+	) {
+		NSR_LOG("PRESERIALIZING INITIAL STATE");
 
-			NSR_LOG("Result stream length: %x", buffers.serialization.size());
-		}
+		{
+			NSR_LOG("STAGE: APPENDING %x STEPS SINCE SYNC", from.steps_since.size());
+
+			auto& uncompressed = buffers.serialization;
+			uncompressed = from.serialized_state;
 
-		auto& c = buffers.compressed;
+			auto s = augs::ref_memory_stream(uncompressed);
+			s.set_write_pos(uncompressed.size());
+
+			augs::write_bytes(s, from.steps_since);
+		}
 
 		{
 			NSR_LOG("STAGE: COMPRESSION");
 
-			c.clear();
+			output.uncompressed_size = static_cast<uint32_t>(buffers.serialization.size());
+			output.compressed.clear();
 
-			{
-				auto s = augs::ref_memory_stream(c);
-				const auto uncompressed_size = static_cast<uint32_t>(buffers.serialization.size());
-				augs::write_bytes(s, uncompressed_size);
+			augs::compress(buffers.compression_state, buffers.serialization, output.compressed);
 
-				NSR_LOG("Uncompressed size: %x", uncompressed_size);
-			}
+			NSR_LOG("Uncompressed size: %x", output.uncompressed_size);
+			NSR_LOG("Compressed stream size: %x", output.compressed.size());
+		}
+	}
 
-			augs::compress(buffers.compression_state, buffers.serialization, c);
+	template <class F>
+	inline bool initial_arena_state::write_payload(
+		F block_allocator,
+		const preserialized_initial_arena_state& preserialized,
+		const uint32_t client_id,
+		const rcon_level_type rcon
+	) {
+		NSR_LOG("SENDING INITIAL STATE");
 
-			NSR_LOG("Compressed stream size: %x", c.size());
+		const auto& c = preserialized.compressed;
+		const auto block = block_allocator(initial_arena_state_header_size_v + c.size());
+
+		if (block == nullptr) {
+			return false;
 		}
 
-		auto block = block_allocator(c.size());
-		std::memcpy(block, c.data(), c.size());
+		auto h = block;
+
+		std::memcpy(h, &preserialized.uncompressed_size, sizeof(uint32_t));
+		h += sizeof(uint32_t);
+
+		std::memcpy(h, &client_id, sizeof(uint32_t));
+		h += sizeof(uint32_t);
+
+		std::memcpy(h, &rcon, sizeof(rcon_level_type));
+		h += sizeof(rcon_level_type);
+
+		std::memcpy(h, c.data(), c.size());
 
 		return true;
 	}
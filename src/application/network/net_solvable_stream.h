@@ -1,14 +1,9 @@
 #pragma once
+#include "augs/templates/transform_types.h"
+#include "game/cosmos/never_changes_in_game.h"
 
 template <class V>
-constexpr bool never_changes_in_game = is_one_of_v<V,
-	make_entity_pool<static_decoration>,
-	make_entity_pool<box_marker>,
-	make_entity_pool<particles_decoration>,
-	make_entity_pool<wandering_pixels_decoration>,
-	make_entity_pool<point_marker>,
-	make_entity_pool<static_light>
->;
+constexpr bool never_changes_in_game = is_one_of_list_v<V, transform_types_in_list_t<entity_types_never_changing_in_game, make_entity_pool>>;
 
 using physics_bodies = make_entity_pool<plain_sprited_body>;
 using physics_bodies_vector = typename physics_bodies::object_pool_type;
@@ -209,6 +209,16 @@ void server_adapter::send_packets() {
 	server.SendPackets();
 }
 
+void server_adapter::receive_packets() {
+	if (!server.IsRunning()) {
+		return;
+	}
+
+	/* The time of the last advance, so that the time seen by yojimbo never goes back. */
+	server.AdvanceTime(server.GetTime());
+	server.ReceivePackets();
+}
+
 client_adapter::client_adapter(const std::optional<port_type> preferred_binding_port) :
 	connection_config(),
 	adapter(nullptr),
@@ -9,6 +9,7 @@
 #include "application/network/server_step_entropy.h"
 #include "application/network/special_client_request.h"
 #include "application/network/rcon_command.h"
+#include "application/setups/server/rcon_level.h"
 #include "application/setups/server/chat_structs.h"
 #include "application/setups/server/net_statistics_update.h"
 #include "view/mode_gui/arena/arena_player_meta.h"
@@ -81,9 +82,20 @@ struct only_block_message : public yojimbo::BlockMessage {
 	YOJIMBO_MESSAGE_BOILERPLATE();
 };
 
+/*
+	The part of a server step entropy that is the same for all clients.
+	Serialized once per step, then copied into the message of each client.
+*/
+
+struct preserialized_server_step_entropy {
+	message_bytes_type bytes;
+};
+
 template <bool C>
 struct initial_arena_state_payload;
 
+struct preserialized_initial_arena_state;
+
 namespace net_messages {
 	struct client_welcome : public yojimbo::Message {
 		static constexpr bool server_to_client = false;
@@ -156,10 +168,9 @@ namespace net_messages {
 		template <class F>
 		bool write_payload(
 			F block_allocator,
-			augs::serialization_buffers&,
-			const cosmos_solvable_significant& initial_signi,
-			const all_entity_flavours& all_flavours,
-			initial_arena_state_payload<true>
+			const preserialized_initial_arena_state&,
+			uint32_t client_id,
+			rcon_level_type rcon
 		);
 	};
 
@@ -186,6 +197,7 @@ namespace net_messages {
 		static constexpr bool server_to_client = true;
 		static constexpr bool client_to_server = false;
 
+		bool write_payload(const preserialized_server_step_entropy&, const ::prestep_client_context&);
 		bool write_payload(::networked_server_step_entropy&);
 		bool read_payload(::networked_server_step_entropy&);
 	};
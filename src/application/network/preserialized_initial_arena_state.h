@@ -0,0 +1,42 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <optional>
+#include "application/network/network_common.h"
+#include "application/network/server_step_entropy.h"
+
+/*
+	The solvable and the mode sent to a joining client are the same for everyone joining in a given step,
+	so they are serialized and compressed once per step and the bytes are reused for every such client.
+	Only the client id and the rcon level are written per client.
+*/
+
+struct preserialized_initial_arena_state {
+	std::optional<server_step_type> made_at_step;
+
+	uint32_t uncompressed_size = 0;
+	std::vector<std::byte> compressed;
+
+	bool is_fresh_for(const server_step_type step) const {
+		return made_at_step == step;
+	}
+
+	void invalidate() {
+		made_at_step = std::nullopt;
+	}
+};
+
+/*
+	The last step at which every client has inferred all caches from scratch.
+
+	Caches like the physics world depend on the order in which they were built,
+	so a client that infers them fresh at a later step would diverge from everyone else.
+	Instead of making everyone reinfer, the joining client is sent the state at the sync point
+	along with all entropies since, and arrives at the current step with exactly the same caches.
+*/
+
+struct join_sync_point {
+	server_step_type step = 0;
+	std::vector<std::byte> serialized_state;
+	std::vector<server_step_entropy> steps_since;
+};
@@ -49,6 +49,13 @@ public:
 	void send_packets();
 	void stop();
 
+	/* 
+		Reads whatever arrived on the socket without processing any messages,
+		so that the packets waiting in-between ticks do not sit in the kernel buffer.
+	*/
+
+	void receive_packets();
+
 	bool is_running() const;
 	bool can_send_message(const client_id_type&, const game_channel_type&) const;
 	bool has_messages_to_send(const client_id_type&, const game_channel_type&) const;
@@ -1,6 +1,7 @@
 #pragma once
 #include "augs/templates/logically_empty.h"
 #include "game/modes/mode_entropy.h"
+#include "game/cosmos/solvable_signi_digest.h"
 
 using server_step_entropy = mode_entropy;
 
@@ -86,12 +87,12 @@ struct server_step_entropy_meta {
 	static constexpr bool force_read_field_by_field = true;
 
 	// GEN INTROSPECTOR struct server_step_entropy_meta
-	std::optional<uint32_t> state_hash;
+	std::optional<solvable_signi_digest> state_digest;
 	bool reinference_necessary = false;
 	// END GEN INTROSPECTOR
 
 	bool operator==(const server_step_entropy_meta& b) const {
-		return state_hash == b.state_hash && reinference_necessary == b.reinference_necessary;
+		return state_digest == b.state_digest && reinference_necessary == b.reinference_necessary;
 	}
 };
 
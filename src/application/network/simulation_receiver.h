@@ -159,9 +159,9 @@ public:
 				const auto& meta = actual_server_step.meta;
 
 				{
-					const auto received_hash = meta.state_hash;
+					const auto& received_digest = meta.state_digest;
 
-					if (received_hash != std::nullopt) {
+					if (received_digest != std::nullopt) {
 #if TEST_DESYNC_DETECTION
 						auto total = referential_cosmos.get_total_steps_passed();
 						bool simulate_desync = false;
@@ -186,16 +186,13 @@ public:
 						}
 #endif
 
-						const auto client_state_hash = 
-							referential_cosmos.template calculate_solvable_signi_hash<uint32_t>()
-						;
+						const auto client_digest = referential_cosmos.calculate_solvable_signi_digest();
 
-						if (*received_hash != client_state_hash) {
+						if (*received_digest != client_digest) {
 							LOG(
-								"Client desynchronized at step: %x. Hashes differ.\nExpected: %x\nActual: %x\n",
+								"Client desynchronized at step: %x. Digests differ in:\n%x",
 								referential_cosmos.get_total_steps_passed(),
-							   	*received_hash,
-							   	client_state_hash
+							   	client_digest.describe_differences(*received_digest)
 							);
 
 							result.desync = true;
@@ -204,10 +201,10 @@ public:
 				}
 
 				{
-					const bool shall_reinfer = meta.reinference_necessary || logically_set(actual_server_step.payload.general.added_player);
+					const bool shall_reinfer = meta.reinference_necessary;
 
 					if (shall_reinfer) {
-						LOG("Added player in the next entropy. Will reinfer to sync.");
+						LOG("The server has requested reinference. Will reinfer to sync.");
 						cosmic::reinfer_solvable(referential_arena.get_cosmos());
 					}
 
@@ -270,7 +267,8 @@ public:
 
 			::save_interpolations(transfer_caches, std::as_const(predicted_cosmos));
 
-			predicted_arena.transfer_all_solvables(referential_arena);
+			/* The predicted arena received all solvables when the initial state arrived. */
+			predicted_arena.transfer_solvables_changing_in_game(referential_arena);
 
 			for (auto& predicted_step_entropy : predicted_entropies) {
 				predict_intents_of_remote_entities(
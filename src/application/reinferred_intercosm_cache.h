@@ -0,0 +1,30 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+struct intercosm;
+
+/*
+	Reinferring is what takes the longest when loading an arena,
+	and servers keep cycling through the same few of them.
+
+	The reinferred state cannot be written to disk as it is full of pointers,
+	the Box2D world above all, so instead the last few arenas are kept in memory already reinferred,
+	and are identified by the hash of their files' contents.
+
+	Whoever wants this owns an instance and passes it to intercosm::load_from_bytes.
+*/
+
+class reinferred_intercosm_cache {
+	static constexpr std::size_t max_entries = 2;
+
+	std::vector<std::pair<uint64_t, std::unique_ptr<intercosm>>> entries;
+
+public:
+	reinferred_intercosm_cache();
+	~reinferred_intercosm_cache();
+
+	bool copy_if_found(uint64_t hash, intercosm& into) const;
+	void remember(uint64_t hash, const intercosm& loaded);
+};
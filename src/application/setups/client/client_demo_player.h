@@ -1,20 +1,111 @@
 #pragma once
+#include <map>
+#include <memory>
 #include "application/gui/client/demo_player_gui.h"
 #include "augs/misc/timing/fixed_delta_timer.h"
+#include "augs/filesystem/mapped_file.h"
+#include "application/setups/client/client_demo_snapshot.h"
 
 struct client_demo_player {
 	int additional_steps = 0;
 	std::string replay_failed_reason;
 	augs::path_type source_path;
+	std::unique_ptr<augs::mapped_file> source;
 	demo_player_gui gui = std::string("Player");
 	bool paused = false;
 	demo_file_meta meta;
 	demo_step default_step;
 
 	std::optional<demo_step_num_type> requested_seek;
-	std::vector<demo_step> demo_steps;
 	demo_step_num_type current_step = 0;
 
+	struct chunk_entry {
+		demo_chunk_header header;
+		demo_step_num_type first_step = 0;
+		std::size_t offset = 0;
+	};
+
+	std::vector<chunk_entry> chunks;
+	demo_step_num_type total_steps = 0;
+
+	std::optional<std::size_t> loaded_chunk;
+	std::vector<demo_step> loaded_steps;
+
+	void load_chunk(std::size_t index);
+
+	struct keyframe {
+		double secs = 0.0;
+		client_demo_snapshot state;
+	};
+
+	/*
+		Taken while playing so that seeking can start from the nearest earlier keyframe.
+		Whenever there are too many, every other one is dropped and the interval doubles,
+		so a long demo still has keyframes spread evenly across its whole length.
+	*/
+
+	static constexpr std::size_t max_keyframes = 32;
+	static constexpr demo_step_num_type default_keyframe_interval = 128 * 10;
+
+	std::map<demo_step_num_type, keyframe> keyframes;
+	demo_step_num_type keyframe_interval = default_keyframe_interval;
+
+	template <class TakeSnapshot>
+	void push_keyframe_if_needed(TakeSnapshot& take_snapshot) {
+		if (current_step % keyframe_interval != 0 || keyframes.find(current_step) != keyframes.end()) {
+			return;
+		}
+
+		auto& k = keyframes[current_step];
+
+		if (!take_snapshot(k.state)) {
+			keyframes.erase(current_step);
+			return;
+		}
+
+		k.secs = current_secs;
+
+		if (keyframes.size() > max_keyframes) {
+			keyframe_interval *= 2;
+
+			for (auto it = keyframes.begin(); it != keyframes.end();) {
+				if (it->first % keyframe_interval != 0) {
+					it = keyframes.erase(it);
+				}
+				else {
+					++it;
+				}
+			}
+		}
+	}
+
+	template <class LoadSnapshot>
+	bool load_nearest_keyframe(const demo_step_num_type target_step, LoadSnapshot& load_snapshot) {
+		auto it = keyframes.upper_bound(target_step);
+
+		if (it == keyframes.begin()) {
+			return false;
+		}
+
+		--it;
+
+		const bool seeking_backward = target_step < current_step;
+		const bool keyframe_closer = it->first > current_step;
+
+		if (!seeking_backward && !keyframe_closer) {
+			return false;
+		}
+
+		if (!load_snapshot(std::as_const(it->second.state))) {
+			return false;
+		}
+
+		current_step = it->first;
+		current_secs = it->second.secs;
+
+		return true;
+	}
+
 	double speed = 1.0;
 	double current_secs = 0.0;
 
@@ -31,7 +122,7 @@ struct client_demo_player {
 	}
 
 	bool all_steps_played() const {
-		return current_step >= demo_steps.size();
+		return current_step >= total_steps;
 	}
 
 	bool is_paused() const {
@@ -43,7 +134,7 @@ struct client_demo_player {
 	}
 
 	auto get_total_steps() const {
-		return demo_steps.size();
+		return total_steps;
 	}
 
 	auto get_current_secs() const {
@@ -60,13 +151,7 @@ struct client_demo_player {
 		return is_paused() ? 0.0 : speed;
 	}
 
-	const auto& get_nth_step(const demo_step_num_type n) const {
-		if (all_steps_played()) {
-			return default_step;
-		}
-
-		return demo_steps[n];
-	}
+	const demo_step& get_nth_step(demo_step_num_type n);
 
 	void seek_backward(const demo_step_num_type offset) {
 		seek_to(current_step - std::min(current_step, offset));
@@ -80,8 +165,9 @@ struct client_demo_player {
 		requested_seek = n;
 	}
 
-	template <class StepState>
-	void advance_player(StepState advance_state) {
+	template <class StepState, class TakeSnapshot>
+	void advance_player(StepState advance_state, TakeSnapshot& take_snapshot) {
+		push_keyframe_if_needed(take_snapshot);
 		current_secs += advance_state(get_nth_step(current_step++));
 	}
 
@@ -92,23 +178,27 @@ struct client_demo_player {
 		current_secs = 0;
 	}
 
-	template <class StepState, class SeekingStepState, class RewindState>
+	template <class StepState, class SeekingStepState, class RewindState, class TakeSnapshot, class LoadSnapshot>
 	void advance(
 		augs::delta frame_delta,
 		StepState step_state, 
 		SeekingStepState seeking_step_state, 
 		RewindState rewind_state,
+		TakeSnapshot take_snapshot,
+		LoadSnapshot load_snapshot,
 		const double inv_tickrate
 	) {
 		if (requested_seek != std::nullopt) {
 			const auto target_step = *requested_seek;
 
-			if (target_step < current_step) {
-				rewind_player(rewind_state);
+			if (!load_nearest_keyframe(target_step, load_snapshot)) {
+				if (target_step < current_step) {
+					rewind_player(rewind_state);
+				}
 			}
 
 			while (current_step < target_step) {
-				advance_player(seeking_step_state);
+				advance_player(seeking_step_state, take_snapshot);
 			}
 
 			requested_seek = std::nullopt;
@@ -125,9 +215,9 @@ struct client_demo_player {
 		}
 
 		while (steps--) {
-			advance_player(step_state);
+			advance_player(step_state, take_snapshot);
 
-			if (current_step == demo_steps.size()) {
+			if (current_step == total_steps) {
 				pause();
 			}
 		}
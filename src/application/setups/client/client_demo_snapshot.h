@@ -0,0 +1,36 @@
+#pragma once
+#include "game/cosmos/cosmos.h"
+#include "game/modes/mode_player_id.h"
+#include "game/modes/ruleset_id.h"
+#include "application/arena/mode_and_rules.h"
+#include "application/setups/server/server_vars.h"
+#include "application/network/simulation_receiver.h"
+#include "view/mode_gui/arena/arena_player_meta.h"
+#include "augs/network/network_types.h"
+
+/*
+	Everything that the replayed server messages and steps can change,
+	copied in memory every so often so that seeking does not have to replay the demo from the start.
+
+	The arena itself (viewables, rulesets, round template) is not copied.
+	A snapshot is only loaded if the same arena is currently loaded.
+*/
+
+struct client_demo_snapshot {
+	cosmos referential_cosmos;
+	cosmos_solvable_significant initial_signi;
+	online_mode_and_rules current_mode;
+
+	cosmos predicted_cosmos;
+	online_mode_and_rules predicted_mode;
+
+	server_vars sv_vars;
+	server_solvable_vars sv_solvable_vars;
+
+	mode_player_id client_player_id;
+	arena_player_metas player_metas;
+	simulation_receiver receiver;
+	bool now_resyncing = false;
+
+	net_time_t client_time = 0.0;
+};
@@ -37,6 +37,8 @@
 #include "augs/misc/time_utils.h"
 #include "application/network/net_message_serializers.h"
 #include "augs/readwrite/byte_file.h"
+#include "augs/misc/compress.h"
+#include "augs/filesystem/mapped_file.h"
 #include "application/gui/client/demo_player_gui.hpp"
 
 #include "application/setups/client/handle_server_payload.hpp"
@@ -47,14 +49,111 @@
 
 void client_demo_player::play_demo_from(const augs::path_type& p) {
 	source_path = p;
-	auto source = augs::open_binary_input_stream(source_path);
+	source = std::make_unique<augs::mapped_file>(source_path);
 
-	augs::read_bytes(source, meta);
-	augs::read_vector_until_eof(source, demo_steps);
+	auto s = source->make_read_stream();
+
+	augs::read_bytes(s, meta);
+
+	chunks.clear();
+	loaded_steps.clear();
+	loaded_chunk = std::nullopt;
+	total_steps = 0;
+
+	keyframes.clear();
+	keyframe_interval = default_keyframe_interval;
+
+	if (const auto first_byte = s.has_unread_bytes() ? s.peek<uint8_t>() : uint8_t(0xff); first_byte == 0 || first_byte == 1) {
+		/* Recorded before chunking. Keep all steps as a single, always loaded chunk. */
+
+		while (s.has_unread_bytes()) {
+			augs::read_bytes(s, loaded_steps.emplace_back());
+		}
+
+		chunk_entry entry;
+		entry.header.num_steps = static_cast<uint32_t>(loaded_steps.size());
+
+		chunks.push_back(entry);
+		loaded_chunk = 0;
+		total_steps = entry.header.num_steps;
+	}
+	else {
+		while (s.get_unread_bytes() >= sizeof(demo_chunk_header)) {
+			chunk_entry entry;
+
+			augs::read_bytes(s, entry.header);
+			entry.offset = s.get_read_pos();
+			entry.first_step = total_steps;
+
+			if (entry.header.magic != DEMO_CHUNK_MAGIC || entry.header.compressed_size > s.get_unread_bytes()) {
+				/* The recording was likely interrupted mid-flush. Play what was written in full. */
+				break;
+			}
+
+			chunks.push_back(entry);
+			total_steps += entry.header.num_steps;
+
+			s.set_read_pos(entry.offset + entry.header.compressed_size);
+		}
+	}
 
 	gui.open();
 }
 
+void client_demo_player::load_chunk(const std::size_t index) {
+	const auto& entry = chunks[index];
+
+	loaded_steps.clear();
+	loaded_chunk = index;
+
+	thread_local std::vector<std::byte> serialized;
+
+	try {
+		serialized.resize(entry.header.uncompressed_size);
+		augs::decompress(source->data() + entry.offset, entry.header.compressed_size, serialized);
+
+		auto in = augs::cref_memory_stream(serialized);
+
+		loaded_steps.resize(entry.header.num_steps);
+
+		for (auto& step : loaded_steps) {
+			augs::read_bytes(in, step);
+		}
+	}
+	catch (const augs::decompression_error& err) {
+		replay_failed_reason = err.what();
+	}
+	catch (const augs::stream_read_error& err) {
+		replay_failed_reason = err.what();
+	}
+
+	/* Keep the step indices valid even if the chunk was corrupt - its steps will just be empty. */
+	loaded_steps.resize(entry.header.num_steps);
+}
+
+const demo_step& client_demo_player::get_nth_step(const demo_step_num_type n) {
+	if (all_steps_played() || n >= total_steps) {
+		return default_step;
+	}
+
+	const auto chunk_of_step = std::upper_bound(
+		chunks.begin(),
+		chunks.end(),
+		n,
+		[](const demo_step_num_type step, const chunk_entry& entry) {
+			return step < entry.first_step;
+		}
+	);
+
+	const auto index = static_cast<std::size_t>(std::prev(chunk_of_step) - chunks.begin());
+
+	if (loaded_chunk != index) {
+		load_chunk(index);
+	}
+
+	return loaded_steps[n - chunks[index].first_step];
+}
+
 bool client_demo_player::control(const handle_input_before_game_input in) {
 	using namespace augs::event;
 	using namespace augs::event::keys;
@@ -141,6 +240,63 @@ void client_setup::play_demo_from(const augs::path_type& p) {
 	demo_player.play_demo_from(p);
 }
 
+bool client_setup::take_demo_snapshot(client_demo_snapshot& into) const {
+	if (state != client_state_type::IN_GAME) {
+		return false;
+	}
+
+	into.referential_cosmos = scene.world;
+	into.initial_signi = initial_signi;
+	into.current_mode = current_mode;
+
+	into.predicted_cosmos = predicted_cosmos;
+	into.predicted_mode = predicted_mode;
+
+	into.sv_vars = sv_vars;
+	into.sv_solvable_vars = sv_solvable_vars;
+
+	into.client_player_id = client_player_id;
+	into.player_metas = player_metas;
+	into.receiver = receiver;
+	into.now_resyncing = now_resyncing;
+
+	into.client_time = client_time;
+
+	return true;
+}
+
+bool client_setup::load_demo_snapshot(const client_demo_snapshot& from) {
+	/* 
+		The arena files are not part of the snapshot.
+		If a different arena is loaded now, let the caller replay from the start.
+	*/
+
+	if (state != client_state_type::IN_GAME || from.sv_solvable_vars.current_arena != sv_solvable_vars.current_arena) {
+		return false;
+	}
+
+	scene.world = from.referential_cosmos;
+	initial_signi = from.initial_signi;
+	current_mode = from.current_mode;
+
+	predicted_cosmos = from.predicted_cosmos;
+	predicted_mode = from.predicted_mode;
+
+	sv_vars = from.sv_vars;
+	sv_solvable_vars = from.sv_solvable_vars;
+
+	client_player_id = from.client_player_id;
+	player_metas = from.player_metas;
+	receiver = from.receiver;
+	now_resyncing = from.now_resyncing;
+
+	client_time = from.client_time;
+
+	rebuild_player_meta_viewables = true;
+
+	return true;
+}
+
 void client_setup::flush_demo_steps() {
 	if (unflushed_demo_steps.empty()) {
 		return;
@@ -167,10 +323,27 @@ void client_setup::flush_demo_steps() {
 				was_demo_meta_written = true;
 			}
 
-			for (const auto& s : demo_steps_being_flushed) {
-				augs::write_bytes(out, s);
+			auto& b = demo_flush_buffers;
+
+			{
+				auto s = b.make_serialization_stream();
+
+				for (const auto& step : demo_steps_being_flushed) {
+					augs::write_bytes(s, step);
+				}
 			}
 
+			b.compressed.clear();
+			augs::compress(b.compression_state, b.serialization, b.compressed);
+
+			demo_chunk_header header;
+			header.num_steps = static_cast<uint32_t>(demo_steps_being_flushed.size());
+			header.uncompressed_size = static_cast<uint32_t>(b.serialization.size());
+			header.compressed_size = static_cast<uint32_t>(b.compressed.size());
+
+			augs::write_bytes(out, header);
+			out.write(reinterpret_cast<const char*>(b.compressed.data()), b.compressed.size());
+
 			out.flush();
 			demo_steps_being_flushed.clear();
 		}
@@ -19,6 +19,7 @@
 #include "application/setups/server/rcon_level.h"
 
 #include "application/predefined_rulesets.h"
+#include "game/modes/round_template.h"
 #include "application/arena/mode_and_rules.h"
 #include "augs/readwrite/memory_stream_declaration.h"
 #include "augs/misc/serialization_buffers.h"
@@ -66,6 +67,7 @@ class client_setup :
 	/* This is loaded from the arena folder */
 	intercosm scene;
 	cosmos_solvable_significant initial_signi;
+	round_template round_start_template;
 
 	predefined_rulesets rulesets;
 
@@ -130,6 +132,7 @@ class client_setup :
 	std::vector<demo_step> unflushed_demo_steps;
 	std::vector<demo_step> demo_steps_being_flushed;
 	std::future<void> future_flushed_demo;
+	augs::serialization_buffers demo_flush_buffers;
 	bool was_demo_meta_written = false;
 
 	client_demo_player demo_player;
@@ -163,7 +166,8 @@ class client_setup :
 				self.scene,
 				self.predicted_cosmos,
 				self.rulesets,
-				self.initial_signi
+				self.initial_signi,
+				std::addressof(self.round_start_template)
 			};
 		}
 		else {
@@ -174,7 +178,8 @@ class client_setup :
 				self.scene,
 				self.scene.world,
 				self.rulesets,
-				self.initial_signi
+				self.initial_signi,
+				std::addressof(self.round_start_template)
 			};
 		}
 	}
@@ -203,6 +208,9 @@ class client_setup :
 	void play_demo_from(const augs::path_type&);
 	void record_demo_to(const augs::path_type&);
 
+	bool take_demo_snapshot(client_demo_snapshot&) const;
+	bool load_demo_snapshot(const client_demo_snapshot&);
+
 	void handle_server_messages_from(const demo_step&);
 
 	auto make_accumulator_input(const client_advance_input& in) {
@@ -635,11 +643,26 @@ public:
 				demo_player = std::move(player_backup);
 			};
 
+			auto take_snapshot = [&](client_demo_snapshot& into) {
+				return take_demo_snapshot(into);
+			};
+
+			auto load_snapshot = [&](const client_demo_snapshot& from) {
+				if (load_demo_snapshot(from)) {
+					needs_snap = true;
+					return true;
+				}
+
+				return false;
+			};
+
 			demo_player.advance(
 				in.frame_delta,
 				advance_with,
 				seeking_advance,
 				rewind,
+				take_snapshot,
+				load_snapshot,
 				get_inv_tickrate()
 			);
 
@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 #include <map>
+#include <cstdint>
 #include "application/setups/client/demo_file_meta.h"
 #include "augs/templates/snapshotted_player_step_type.h"
 
@@ -8,6 +9,28 @@ struct demo_step;
 using demo_step_num_type = augs::snapshotted_player_step_type;
 using demo_step_map = std::map<demo_step_num_type, demo_step>;
 
+/*
+	After the meta, a demo is a sequence of chunks,
+	each written with a single flush of the recorder:
+
+	demo_chunk_header, followed by compressed_size bytes of LZ4-compressed steps.
+
+	Playback only indexes the headers and keeps a single chunk decompressed at a time.
+	Demos recorded before chunking follow the meta with raw steps instead.
+	These begin with a boolean, so they are told apart by the first byte of the magic.
+*/
+
+constexpr uint32_t DEMO_CHUNK_MAGIC = 0x314b4344; /* "DCK1" */
+
+struct demo_chunk_header {
+	// GEN INTROSPECTOR struct demo_chunk_header
+	uint32_t magic = DEMO_CHUNK_MAGIC;
+	uint32_t num_steps = 0;
+	uint32_t uncompressed_size = 0;
+	uint32_t compressed_size = 0;
+	// END GEN INTROSPECTOR
+};
+
 struct demo_file {
 	// GEN INTROSPECTOR struct demo_file
 	demo_file_meta meta;
@@ -167,6 +167,7 @@ message_handler_result client_setup::handle_server_payload(
 		now_resyncing = false;
 
 		uint32_t read_client_id;
+		std::vector<server_step_entropy> steps_since_sync;
 
 		cosmic::change_solvable_significant(
 			scene.world, 
@@ -179,6 +180,7 @@ message_handler_result client_setup::handle_server_payload(
 					initial_payload {
 						signi,
 						current_mode,
+						steps_since_sync,
 						read_client_id,
 						client_gui.rcon.level
 					}
@@ -190,14 +192,32 @@ message_handler_result client_setup::handle_server_payload(
 
 		client_player_id = static_cast<mode_player_id>(read_client_id);
 
+		auto predicted = get_arena_handle(client_arena_type::PREDICTED);
+		const auto referential = get_arena_handle(client_arena_type::REFERENTIAL);
+
+		/*
+			The received state is from the last step at which everyone has reinferred.
+			Replaying the steps since brings our caches to exactly where everyone else's are.
+		*/
+
+		LOG("Catching up %x steps since the sync point.", steps_since_sync.size());
+
+		for (const auto& step : steps_since_sync) {
+			referential.advance(step, solver_callbacks(), solve_settings());
+
+			const auto& added = step.general.added_player;
+
+			if (!was_resyncing && logically_set(added)) {
+				/* When resyncing, we have already seen these sessions begin. */
+				handle_new_session(added);
+			}
+		}
+
 		LOG("Received initial state from the server at step: %x.", scene.world.get_timestamp().step);
 		LOG("Received client id: %x", client_player_id.value);
 
 		state = client_state_type::IN_GAME;
 
-		auto predicted = get_arena_handle(client_arena_type::PREDICTED);
-		const auto referential = get_arena_handle(client_arena_type::REFERENTIAL);
-
 		auto& predicted_cosmos = predicted.advanced_cosm;
 
 		if (was_resyncing) {
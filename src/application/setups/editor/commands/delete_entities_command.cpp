@@ -15,7 +15,7 @@ std::string delete_entities_command::describe() const {
 void delete_entities_command::push_entry(const const_entity_handle handle) {
 	handle.dispatch([&](const auto typed_handle) {
 		using E = entity_type_of<decltype(typed_handle)>;
-		deleted_entities.get_for<E>().push_back({ typed_handle.get(), handle.get_id(), {} });
+		deleted_entities.get_for<E>().push_back({ typed_handle.get(), cosmic::get_hot_components(typed_handle), handle.get_id(), {} });
 	});
 
 	deleted_grouping.push_entry(handle.get_id());
@@ -56,7 +56,7 @@ void delete_entities_command::undo(const editor_command_input in) {
 		*/
 
 		deleted_entities.for_each_reverse([&](const auto& e) {
-			const auto undeleted = cosmic::undo_delete_entity(cosm, e.undo_delete_input, e.content, reinference_type::NONE);
+			const auto undeleted = cosmic::undo_delete_entity(cosm, e.undo_delete_input, e.content, e.hot_content, reinference_type::NONE);
 			selections.emplace(undeleted.get_id());
 		});
 	}
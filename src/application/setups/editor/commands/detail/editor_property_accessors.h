@@ -2,6 +2,7 @@
 #include "application/setups/editor/property_editor/on_field_address.h"
 #include "game/cosmos/change_common_significant.hpp"
 #include "game/cosmos/cosmic_functions.h"
+#include "game/cosmos/get_corresponding.h"
 
 template <class T>
 static constexpr bool should_reinfer_after_change(const T&) {
@@ -132,8 +133,17 @@ struct editor_property_accessors {
 						for (const auto& e : entity_ids) {
 							auto specific_handle = cosm[typed_entity_id<E>(e)];
 
+							auto& component = [&]() -> auto& {
+								if constexpr(is_hot_component_v<E, Component>) {
+									return get_hot_component<Component>(specific_handle);
+								}
+								else {
+									return std::get<Component>(specific_handle.get({}).component_state);
+								}
+							}();
+
 							const auto result = on_field_address(
-								std::get<Component>(specific_handle.get({}).component_state),
+								component,
 								self.field,
 								[&](auto& resolved_field) -> callback_result {
 									return callback(resolved_field);
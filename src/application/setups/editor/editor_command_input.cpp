@@ -84,6 +84,7 @@ editor_command_input editor_command_input::make_dummy_for(sol::state& lua, edito
 	thread_local dummies d;
 
 	d.settings.player.snapshot_interval_in_steps = 0;
+	d.settings.history_checkpoints.interval_in_revisions = 0;
 
 	return editor_command_input {
 		lua,
@@ -9,6 +9,7 @@
 #include "augs/readwrite/byte_file.h"
 #include "augs/readwrite/lua_file.h"
 #include "game/cosmos/entity_handle.h"
+#include "game/detail/pathfinding/bake_navmesh.h"
 
 #include "application/arena/arena_utils.h"
 #include "hypersomnia_version.h"
@@ -16,9 +17,10 @@
 void load_arena_from(
 	const arena_paths& paths,
 	intercosm& scene,
-	predefined_rulesets& rulesets
+	predefined_rulesets& rulesets,
+	reinferred_intercosm_cache* const reinferred_cache
 ) {
-	scene.load_from_bytes(paths.int_paths);
+	scene.load_from_bytes(paths.int_paths, reinferred_cache);
 
 	try {
 		augs::load_from_bytes(rulesets, paths.rulesets_file_path);
@@ -75,6 +77,7 @@ void editor_folder::save_folder(const augs::path_type& to, const augs::path_type
 	augs::create_directory(to / maybe_official_path<assets::sound_id>::get_content_suffix());
 	augs::create_directory(paths.default_export_path);
 
+	::rebake_navmesh(commanded->work.world);
 	commanded->work.save_as_bytes(paths.arena.int_paths);
 
 	augs::save_as_bytes(commanded->view_ids, paths.view_ids_file);
@@ -126,6 +129,9 @@ void editor_folder::load_folder(const augs::path_type& from, const augs::path_ty
 	catch (const augs::file_open_error&) {
 		/* We just let it happen. These files are not necessary. */
 	}
+
+	/* Whatever was checkpointed before does not correspond to the loaded history. */
+	history.clear_checkpoints();
 }
 
 void editor_folder::mark_as_just_saved() {
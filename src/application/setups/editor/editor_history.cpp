@@ -1,6 +1,174 @@
+#include <algorithm>
+#include <cstdlib>
 #include "application/setups/editor/editor_history.h"
 #include "augs/templates/history.hpp"
 #include "application/setups/editor/editor_player.h"
+#include "application/setups/editor/editor_folder.h"
+#include "application/setups/editor/editor_settings.h"
+#include "augs/misc/compress.h"
+#include "augs/readwrite/memory_stream.h"
+#include "augs/readwrite/byte_readwrite.h"
+
+/*
+	Restoring a checkpoint reinfers everything once,
+	which costs about as much as a few commands that do the same.
+*/
+
+constexpr int CHECKPOINT_RESTORE_COST_IN_COMMANDS = 4;
+
+void editor_history_checkpoints::erase_at(const std::size_t index) {
+	total_bytes -= checkpoints[index].compressed.size();
+	checkpoints.erase(checkpoints.begin() + index);
+}
+
+void editor_history_checkpoints::clear() {
+	checkpoints.clear();
+	total_bytes = 0;
+}
+
+void editor_history_checkpoints::invalidate_from(const int revision) {
+	while (!checkpoints.empty() && checkpoints.back().revision >= revision) {
+		erase_at(checkpoints.size() - 1);
+	}
+}
+
+bool editor_history_checkpoints::is_due(const int revision, const editor_history_checkpoint_settings& settings) const {
+	const auto interval = static_cast<int>(settings.interval_in_revisions);
+
+	if (interval == 0 || revision < 0 || (revision + 1) % interval != 0) {
+		return false;
+	}
+
+	for (const auto& c : checkpoints) {
+		if (c.revision == revision) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void editor_history_checkpoints::make(
+	const int revision,
+	const editor_commanded_state& state,
+	const editor_history_checkpoint_settings& settings
+) {
+	if (compression_state.empty()) {
+		compression_state = augs::make_compression_state();
+	}
+
+	serialized.clear();
+
+	{
+		auto s = augs::ref_memory_stream(serialized);
+		augs::write_bytes(s, state);
+	}
+
+	editor_history_checkpoint new_checkpoint;
+	new_checkpoint.revision = revision;
+	new_checkpoint.uncompressed_size = serialized.size();
+	augs::compress(compression_state, serialized, new_checkpoint.compressed);
+
+	total_bytes += new_checkpoint.compressed.size();
+
+	const auto it = std::lower_bound(
+		checkpoints.begin(), 
+		checkpoints.end(), 
+		revision, 
+		[](const auto& c, const int r) { return c.revision < r; }
+	);
+
+	checkpoints.insert(it, std::move(new_checkpoint));
+
+	/* 
+		Over the budget, drop the checkpoints farthest from the one just made,
+		as the history is usually scrubbed around where the work happens.
+	*/
+
+	const auto budget = std::size_t(settings.memory_budget_in_megabytes) * 1024 * 1024;
+
+	while (total_bytes > budget && checkpoints.size() > 1) {
+		const auto distance = [revision](const auto& c) { return std::abs(c.revision - revision); };
+
+		const bool drop_front = distance(checkpoints.front()) >= distance(checkpoints.back());
+		erase_at(drop_front ? 0 : checkpoints.size() - 1);
+	}
+}
+
+const editor_history_checkpoint* editor_history_checkpoints::find_closest(const int revision) const {
+	const editor_history_checkpoint* closest = nullptr;
+
+	for (const auto& c : checkpoints) {
+		if (closest == nullptr || std::abs(c.revision - revision) < std::abs(closest->revision - revision)) {
+			closest = std::addressof(c);
+		}
+	}
+
+	return closest;
+}
+
+void editor_history_checkpoints::restore(const editor_history_checkpoint& c, editor_commanded_state& into) const {
+	std::vector<std::byte> decompressed;
+	decompressed.resize(c.uncompressed_size);
+
+	augs::decompress(c.compressed, decompressed);
+
+	auto s = augs::cref_memory_stream(decompressed);
+	augs::read_bytes(s, into);
+}
+
+void editor_history::clear_checkpoints() {
+	checkpoints.clear();
+}
+
+/*
+	A revision is checkpointed only once it is being left.
+	Until then its command may still be rewritten in place,
+	e.g. by the entity mover during a drag or by the property tweakers,
+	so a checkpoint taken right after executing it could hold a state the command no longer produces.
+*/
+
+void editor_history::checkpoint_before_leaving(const editor_command_input cmd_in) {
+	const auto& settings = cmd_in.settings.history_checkpoints;
+	const auto revision = get_current_revision();
+
+	if (cmd_in.get_player().has_testing_started()) {
+		return;
+	}
+
+	if (checkpoints.is_due(revision, settings)) {
+		checkpoints.make(revision, *cmd_in.folder.commanded, settings);
+	}
+}
+
+void editor_history::after_executed_new() {
+	checkpoints.invalidate_from(get_current_revision());
+}
+
+void editor_history::restore_closest_checkpoint_if_faster(
+	const index_type target_revision, 
+	const editor_command_input cmd_in
+) {
+	const auto closest = checkpoints.find_closest(target_revision);
+
+	if (closest == nullptr) {
+		return;
+	}
+
+	const auto commands_from_current = std::abs(target_revision - get_current_revision());
+	const auto commands_from_checkpoint = std::abs(target_revision - closest->revision) + CHECKPOINT_RESTORE_COST_IN_COMMANDS;
+
+	if (commands_from_checkpoint >= commands_from_current) {
+		return;
+	}
+
+	cmd_in.interrupt_tweakers();
+
+	checkpoints.restore(*closest, *cmd_in.folder.commanded);
+	force_set_current_revision(closest->revision);
+
+	cmd_in.clear_dead_entities();
+}
 
 template <class T>
 static bool has_parent(const T& cmd) {
@@ -70,11 +238,22 @@ void editor_history::seek_to_revision(
 		p.begin_replaying(cmd_in.folder);
 	}
 
+	if (!p.has_testing_started()) {
+		checkpoint_before_leaving(cmd_in);
+		restore_closest_checkpoint_if_faster(target_revision, cmd_in);
+
+		if (target_revision == get_current_revision()) {
+			return;
+		}
+	}
+
 	auto do_redo = [&]() {
+		checkpoint_before_leaving(cmd_in);
 		editor_history_base::redo(cmd_in);
 	};
 
 	auto do_undo = [&]() {
+		checkpoint_before_leaving(cmd_in);
 		editor_history_base::undo(cmd_in);
 	};
 
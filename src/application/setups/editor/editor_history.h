@@ -20,6 +20,7 @@
 
 #include "application/setups/editor/editor_history_declaration.h"
 #include "application/setups/editor/editor_command_input.h"
+#include "application/setups/editor/editor_history_checkpoints.h"
 
 struct editor_history : public editor_history_base {
 	using introspect_base = editor_history_base;
@@ -29,6 +30,14 @@ struct editor_history : public editor_history_base {
 	augs::date_time when_created;
 	// END GEN INTROSPECTOR
 
+private:
+	editor_history_checkpoints checkpoints;
+
+	void checkpoint_before_leaving(editor_command_input);
+	void after_executed_new();
+	void restore_closest_checkpoint_if_faster(index_type n, editor_command_input);
+
+public:
 	template <class T>
 	const T& execute_new(T&& command, editor_command_input);
 
@@ -36,4 +45,6 @@ struct editor_history : public editor_history_base {
 	void undo(editor_command_input);
 
 	void seek_to_revision(index_type n, editor_command_input);
+
+	void clear_checkpoints();
 };
\ No newline at end of file
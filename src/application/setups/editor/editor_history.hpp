@@ -25,8 +25,14 @@ const T& editor_history::execute_new(T&& command, const editor_command_input in)
 
 	command.common.when_happened = in.get_current_step();
 
-	return editor_history_base::execute_new(
+	checkpoint_before_leaving(in);
+
+	const auto& executed = editor_history_base::execute_new(
 		std::forward<T>(command),
 		in
 	);
+
+	after_executed_new();
+
+	return executed;
 }
@@ -0,0 +1,47 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+
+struct editor_commanded_state;
+struct editor_history_checkpoint_settings;
+
+/*
+	Compressed copies of the whole commanded state, taken every few revisions.
+
+	Seeking far through the history would otherwise undo or redo every command on the way,
+	many of which reinfer the whole cosmos.
+	With checkpoints, it restores the closest one and only then undoes or redoes the remaining few commands.
+*/
+
+struct editor_history_checkpoint {
+	int revision = -1;
+	std::size_t uncompressed_size = 0;
+	std::vector<std::byte> compressed;
+};
+
+class editor_history_checkpoints {
+	std::vector<editor_history_checkpoint> checkpoints;
+	std::vector<std::byte> compression_state;
+	std::vector<std::byte> serialized;
+	std::size_t total_bytes = 0;
+
+	void erase_at(std::size_t index);
+
+public:
+	void clear();
+
+	/* Once a new command is executed, the revisions from its own onwards are no longer the same. */
+	void invalidate_from(int revision);
+
+	bool is_due(int revision, const editor_history_checkpoint_settings&) const;
+
+	void make(
+		int revision,
+		const editor_commanded_state&,
+		const editor_history_checkpoint_settings&
+	);
+
+	const editor_history_checkpoint* find_closest(int revision) const;
+
+	void restore(const editor_history_checkpoint&, editor_commanded_state&) const;
+};
@@ -66,6 +66,13 @@ struct editor_action_indicator_settings {
 	// END GEN INTROSPECTOR
 };
 
+struct editor_history_checkpoint_settings {
+	// GEN INTROSPECTOR struct editor_history_checkpoint_settings
+	unsigned interval_in_revisions = 32;
+	unsigned memory_budget_in_megabytes = 256;
+	// END GEN INTROSPECTOR
+};
+
 struct editor_settings {
 	// GEN INTROSPECTOR struct editor_settings
 	editor_autosave_settings autosave;
@@ -77,6 +84,7 @@ struct editor_settings {
 
 	editor_grid_settings grid;
 	augs::snapshotted_player_settings player;
+	editor_history_checkpoint_settings history_checkpoints;
 	bool save_entropies_to_live_file = false;
 
 	editor_camera_settings camera;
@@ -11,6 +11,12 @@ struct server_profiler : public augs::profiler_mixin<server_profiler> {
 	augs::time_measurements solve_simulation;
 	augs::time_measurements send_entropies;
 	augs::time_measurements send_packets;
+
+	/* How late, in milliseconds, the thread woke up for a tick. */
+	augs::amount_measurements<double> tick_jitter_ms;
+
+	/* The percentage of each tick spent waiting for packets or the next tick. */
+	augs::amount_measurements<double> idle_percent;
 	// END GEN INTROSPECTOR
 };
 
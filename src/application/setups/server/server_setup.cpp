@@ -565,9 +565,23 @@ void server_setup::apply(const server_vars& new_vars, const bool force) {
 		if (force || old_vars.network_simulator != new_vars.network_simulator) {
 			server->set(new_vars.network_simulator);
 		}
+
+		if (force || old_vars.num_logic_pool_workers != new_vars.num_logic_pool_workers) {
+			logic_pool.resize(new_vars.num_logic_pool_workers);
+		}
 	}
 }
 
+solve_settings server_setup::make_solve_settings() {
+	solve_settings out;
+
+	if (logic_pool.size() > 0) {
+		out.logic_pool = std::addressof(logic_pool);
+	}
+
+	return out;
+}
+
 void server_setup::apply(const server_solvable_vars& new_vars, const bool force) {
 	const bool any_difference = 
 		force || 
@@ -647,6 +661,8 @@ void server_setup::choose_arena(const std::string& name) {
 	LOG("Choosing arena: %x", name);
 
 	solvable_vars.current_arena = name;
+	preserialized_initial_state.invalidate();
+	sync_point.reset();
 
 	const auto& arena = get_arena_handle();
 
@@ -654,7 +670,8 @@ void server_setup::choose_arena(const std::string& name) {
 		lua,
 		arena,
 		solvable_vars,
-		initial_signi
+		initial_signi,
+		std::addressof(reinferred_arenas)
 	);
 
 	arena_gui.reset();
@@ -906,17 +923,9 @@ void server_setup::advance_clients_state() {
 				client_id, 
 				game_channel_type::SERVER_SOLVABLE_AND_STEPS, 
 
-				buffers,
-
-				initial_signi,
-				scene.world.get_common_significant().flavours,
-
-				initial_arena_state_payload<true> {
-					scene.world.get_solvable().significant,
-					current_mode,
-					sent_client_id,
-					rcon_level
-				}
+				get_preserialized_initial_state(),
+				sent_client_id,
+				rcon_level
 			);
 
 			{
@@ -1200,22 +1209,12 @@ message_handler_result server_setup::handle_client_message(
 						client_id, 
 						game_channel_type::SERVER_SOLVABLE_AND_STEPS, 
 
-						buffers,
-
-						initial_signi,
-						scene.world.get_common_significant().flavours,
-
-						initial_arena_state_payload<true> {
-							scene.world.get_solvable().significant,
-							current_mode,
-							client_id,
-							rcon_level
-						}
+						get_preserialized_initial_state(),
+						client_id,
+						rcon_level
 					);
 				}
 
-				reinference_necessary = true;
-
 				break;
 
 			default: return abort_v;
@@ -1321,20 +1320,44 @@ void server_setup::send_server_step_entropies(const compact_server_step_entropy&
 	networked_server_step_entropy total;
 	total.payload = total_input;
 	total.meta.reinference_necessary = reinference_necessary;
-	total.meta.state_hash = [&]() -> decltype(total.meta.state_hash) {
+	total.meta.state_digest = [&]() -> decltype(total.meta.state_digest) {
 		auto& ticks_remaining = ticks_until_sending_hash;
 
 		if (ticks_remaining == 0) {
-			ticks_remaining = vars.state_hash_once_every_tick;
+			ticks_remaining = std::max(vars.state_hash_once_every_tick, 1u);
 			--ticks_remaining;
 
-			const auto calculated_hash = get_arena_handle().get_cosmos().calculate_solvable_signi_hash<uint32_t>();
-			return calculated_hash;
+			return get_arena_handle().get_cosmos().calculate_solvable_signi_digest();
 		}
 
+		--ticks_remaining;
 		return std::nullopt;
 	}();
 
+	/* Everything but the per-client context is serialized only once. */
+
+	preserialized_server_step_entropy shared;
+
+	const bool serialized_successfully = [&]() {
+		if (net_messages::preserialize_server_step_entropy(shared, total)) {
+			return true;
+		}
+
+		if (total.meta.state_digest != std::nullopt) {
+			/* The digest does not fit next to this step's input. It is enough to send it with the next one. */
+			total.meta.state_digest = std::nullopt;
+			ticks_until_sending_hash = 0;
+
+			return net_messages::preserialize_server_step_entropy(shared, total);
+		}
+
+		return false;
+	}();
+
+	if (!serialized_successfully) {
+		LOG("Failed to serialize the server step entropy.");
+	}
+
 	auto process_client = [&](const auto client_id, auto& c) {
 		const bool its_time_already = 
 			c.state >= client_state_type::RECEIVING_INITIAL_STATE
@@ -1344,37 +1367,33 @@ void server_setup::send_server_step_entropies(const compact_server_step_entropy&
 			return;
 		}
 
-		{
-			{
-				prestep_client_context context;
-				context.num_entropies_accepted = c.num_entropies_accepted;
+		prestep_client_context context;
+		context.num_entropies_accepted = c.num_entropies_accepted;
+
+		/* Reset the counter */
+		c.num_entropies_accepted = 0;
 
 #if CONTEXTS_SEPARATE
-				server->send_payload(
-					client_id, 
-					game_channel_type::SERVER_SOLVABLE_AND_STEPS,
+		server->send_payload(
+			client_id, 
+			game_channel_type::SERVER_SOLVABLE_AND_STEPS,
 
-					context
-				);
-#else
-				total.context = context;
+			context
+		);
 #endif
-			}
-
-			/* Reset the counter */
-			c.num_entropies_accepted = 0;
-		}
 
-		/* TODO PERFORMANCE: only serialize the message once and multicast the same buffer to all clients! */
 		server->send_payload(
 			client_id,
 			game_channel_type::SERVER_SOLVABLE_AND_STEPS,
 
-			total
+			shared,
+			context
 		);
 	};
 
-	for_each_id_and_client(process_client, only_connected_v);
+	if (serialized_successfully) {
+		for_each_id_and_client(process_client, only_connected_v);
+	}
 
 	{
 		const auto& interval = vars.send_net_statistics_update_once_every_secs;
@@ -1424,12 +1443,70 @@ void server_setup::send_server_step_entropies(const compact_server_step_entropy&
 	}
 }
 
-void server_setup::reinfer_if_necessary_for(const compact_server_step_entropy& entropy) {
-	if (reinference_necessary || logically_set(entropy.general.added_player)) {
-		LOG("Server: Added player or reinference_necessary. Will reinfer to sync.");
+void server_setup::reinfer_if_necessary() {
+	if (reinference_necessary) {
+		LOG("Server: reinference_necessary. Will reinfer to sync.");
 		cosmic::reinfer_solvable(get_arena_handle().get_cosmos());
 		reinference_necessary = false;
+
+		make_sync_point();
+	}
+}
+
+void server_setup::make_sync_point() {
+	if (sync_point != std::nullopt && sync_point->step == current_simulation_step) {
+		return;
+	}
+
+	auto& point = sync_point.emplace();
+	point.step = current_simulation_step;
+
+	net_messages::serialize_initial_arena_state(
+		point.serialized_state,
+		initial_signi,
+		scene.world.get_common_significant().flavours,
+		scene.world.get_solvable().significant,
+		current_mode
+	);
+}
+
+void server_setup::log_step_since_sync_point(const server_step_entropy& unpacked) {
+	if (sync_point == std::nullopt) {
+		return;
+	}
+
+	auto& steps = sync_point->steps_since;
+
+	if (steps.size() >= vars.max_join_catch_up_steps) {
+		/* The next joining client will make everyone reinfer instead. */
+		sync_point.reset();
+		return;
+	}
+
+	steps.push_back(unpacked);
+}
+
+const preserialized_initial_arena_state& server_setup::get_preserialized_initial_state() {
+	auto& cached = preserialized_initial_state;
+
+	if (!cached.is_fresh_for(current_simulation_step)) {
+		if (sync_point == std::nullopt) {
+			LOG("Server: no sync point to catch up from. Everyone will reinfer.");
+
+			reinference_necessary = true;
+			make_sync_point();
+		}
+
+		net_messages::preserialize_initial_arena_state(
+			cached,
+			buffers,
+			*sync_point
+		);
+
+		cached.made_at_step = current_simulation_step;
 	}
+
+	return cached;
 }
 
 void server_setup::send_packets_if_its_time() {
@@ -1547,7 +1624,7 @@ bool server_setup::should_have_admin_character() const {
 }
 
 void server_setup::sleep_until_next_tick() {
-	const auto sleep_dt = server_time - get_current_time();
+	const auto sleep_dt = get_secs_until_next_tick();
 
 	if (sleep_dt > 0.0) {
 		const auto mult = std::clamp(vars.sleep_mult, 0.f, 0.9f);
@@ -1558,6 +1635,34 @@ void server_setup::sleep_until_next_tick() {
 	}
 }
 
+bool server_setup::uses_precise_tick_scheduler() const {
+	return vars.precise_tick_scheduler;
+}
+
+augs::network_wait_result server_setup::wait_until_next_tick(augs::network_waiter& waiter) {
+	const auto result = [&]() {
+		auto idle_scope = add_scope_duration(idle_secs);
+		return waiter.wait(get_secs_until_next_tick());
+	}();
+
+	if (result == augs::network_wait_result::DEADLINE) {
+		const auto lateness = -get_secs_until_next_tick();
+		profiler.tick_jitter_ms.measure(1000 * std::max(0.0, lateness));
+
+		if (const auto period = idle_measurement_timer.extract<std::chrono::seconds>(); period > 0.0) {
+			profiler.idle_percent.measure(100 * std::min(1.0, idle_secs / period));
+		}
+
+		idle_secs = 0.0;
+	}
+
+	return result;
+}
+
+void server_setup::receive_packets_between_ticks() {
+	server->receive_packets();
+}
+
 void server_setup::update_stats(server_network_info& info) const {
 	info = server->get_server_network_info();
 }
@@ -1843,7 +1948,7 @@ void server_setup::log_performance() {
 			if (server_time - last_logged_at >= once_every) {
 				profiler.prepare_summary_info();
 
-				const auto summary = typesafe_sprintf(
+				auto summary = typesafe_sprintf(
 					"S: %3f, SS: %3f, AA: %3f, ACS: %3f, SE: %3f, SP: %3f",
 					1000 * profiler.step.get_summary_info().value,
 					1000 * profiler.solve_simulation.get_summary_info().value,
@@ -1853,6 +1958,15 @@ void server_setup::log_performance() {
 					1000 * profiler.send_packets.get_summary_info().value
 				);
 
+				if (profiler.tick_jitter_ms.was_measured()) {
+					summary += typesafe_sprintf(
+						", TJ: %3f (max %3f), IDLE: %2f",
+						profiler.tick_jitter_ms.get_summary_info().value,
+						profiler.tick_jitter_ms.get_maximum_units(),
+						profiler.idle_percent.get_summary_info().value
+					);
+				}
+
 				last_logged_at = server_time;
 				LOG(summary);
 			}
@@ -1880,6 +1994,20 @@ const netcode_socket_t* server_setup::find_underlying_socket() const {
 #include <sol2/sol.hpp>
 #include "augs/readwrite/lua_file.h"
 
+static auto make_test_digest() {
+	solvable_signi_digest d;
+
+	d.clock = 0xdeadbeefdeadbeef;
+	d.specific_names = 0x0123456789abcdef;
+	d.global = 0xfedcba9876543210;
+
+	for (std::size_t i = 0; i < d.pools.size(); ++i) {
+		d.pools[i] = 0xdeadbeef00000000 + i;
+	}
+
+	return d;
+}
+
 TEST_CASE("NetSerialization EmptyEntropies") {
 	{
 		net_messages::server_step_entropy ss;
@@ -1904,11 +2032,11 @@ TEST_CASE("NetSerialization EmptyEntropies") {
 			REQUIRE(ss.bytes.size() == 0);
 
 			networked_server_step_entropy sent;
-			sent.meta.state_hash = 0xdeadbeef;
+			sent.meta.state_digest = make_test_digest();
 			ss.write_payload(sent);
 
-			/* One byte for num of entropies accepted, second byte for signifying empty entropy and existent hash, additional bytes for hash */
-			REQUIRE(ss.bytes.size() == 2 + sizeof(decltype(sent.meta.state_hash)::value_type));
+			/* One byte for num of entropies accepted, second byte for signifying empty entropy and existent digest, additional bytes for digest */
+			REQUIRE(ss.bytes.size() == 2 + sizeof(solvable_signi_digest));
 		}
 	}
 
@@ -1927,6 +2055,31 @@ TEST_CASE("NetSerialization EmptyEntropies") {
 	}
 }
 
+TEST_CASE("NetSerialization PreserializedServerEntropy") {
+	networked_server_step_entropy sent;
+	sent.meta.state_digest = make_test_digest();
+	sent.payload.general.removed_player = mode_player_id::first();
+
+	preserialized_server_step_entropy shared;
+	REQUIRE(net_messages::preserialize_server_step_entropy(shared, sent));
+
+	for (const uint8_t accepted : { 0, 1, 255 }) {
+		net_messages::server_step_entropy ss;
+		ss.Release();
+
+		prestep_client_context context;
+		context.num_entropies_accepted = accepted;
+
+		REQUIRE(ss.write_payload(shared, context));
+
+		networked_server_step_entropy received;
+		REQUIRE(ss.read_payload(received));
+
+		sent.context = context;
+		REQUIRE(received == sent);
+	}
+}
+
 TEST_CASE("NetSerialization ClientEntropy") {
 	net_messages::client_entropy ss;
 	ss.Release();
@@ -2024,7 +2177,7 @@ TEST_CASE("NetSerialization ServerEntropySecond") {
 	ss.Release();
 
 	networked_server_step_entropy sent;
-	sent.meta.state_hash = 0xdeadbeef;
+	sent.meta.state_digest = make_test_digest();
 	sent.meta.reinference_necessary = true;
 
 	const auto naive_bytes = [&]() {
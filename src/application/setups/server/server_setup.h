@@ -5,6 +5,7 @@
 #include "game/detail/render_layer_filter.h"
 #include "application/setups/server/server_start_input.h"
 #include "application/intercosm.h"
+#include "application/reinferred_intercosm_cache.h"
 #include "game/cosmos/cosmos.h"
 #include "game/cosmos/entity_handle.h"
 
@@ -20,6 +21,7 @@
 #include "application/setups/server/server_vars.h"
 #include "application/setups/server/server_client_state.h"
 #include "application/predefined_rulesets.h"
+#include "game/modes/round_template.h"
 #include "application/arena/mode_and_rules.h"
 #include "augs/readwrite/memory_stream_declaration.h"
 #include "augs/misc/serialization_buffers.h"
@@ -27,6 +29,7 @@
 #include "application/network/server_step_entropy.h"
 #include "view/mode_gui/arena/arena_gui_mixin.h"
 #include "application/network/network_common.h"
+#include "application/network/preserialized_initial_arena_state.h"
 
 #include "application/setups/server/chat_structs.h"
 #include "application/gui/client/client_gui_state.h"
@@ -36,6 +39,8 @@
 #include "application/setups/server/server_nat_traversal.h"
 
 #include "application/setups/server/rcon_level.h"
+#include "augs/templates/thread_pool.h"
+#include "augs/network/network_waiter.h"
 
 struct netcode_socket_t;
 struct config_lua_table;
@@ -64,9 +69,13 @@ class server_setup :
 	/* This is loaded from the arena folder */
 	intercosm scene;
 	cosmos_solvable_significant initial_signi;
+	round_template round_start_template;
 
 	predefined_rulesets rulesets;
 
+	/* Arenas recently chosen, so that cycling back to them skips reinference. */
+	reinferred_intercosm_cache reinferred_arenas;
+
 	/* Other replicated state */
 	online_mode_and_rules current_mode;
 
@@ -84,6 +93,8 @@ class server_setup :
 	server_step_type current_simulation_step = 0;
 
 	augs::serialization_buffers buffers;
+	preserialized_initial_arena_state preserialized_initial_state;
+	std::optional<join_sync_point> sync_point;
 
 	entropy_accumulator local_collected;
 	std::vector<mode_player_id> moved_to_spectators;
@@ -113,6 +124,9 @@ class server_setup :
 	net_time_t server_time = 0.0;
 	bool schedule_shutdown = false;
 
+	augs::timer idle_measurement_timer;
+	double idle_secs = 0.0;
+
 	bool rebuild_player_meta_viewables = false;
 	arena_player_metas last_player_metas;
 
@@ -121,6 +135,8 @@ class server_setup :
 
 	server_nat_traversal nat_traversal;
 
+	augs::thread_pool logic_pool = 0;
+
 public:
 	net_time_t last_logged_at = 0;
 	server_profiler profiler;
@@ -129,6 +145,8 @@ private:
 
 	static net_time_t get_current_time();
 
+	solve_settings make_solve_settings();
+
 	template <class H, class S>
 	static decltype(auto) get_arena_handle_impl(S& self) {
 		return H {
@@ -136,7 +154,8 @@ private:
 			self.scene,
 			self.scene.world,
 			self.rulesets,
-			self.initial_signi
+			self.initial_signi,
+			std::addressof(self.round_start_template)
 		};
 	}
 
@@ -179,7 +198,10 @@ private:
 	mode_player_id get_integrated_player_id() const;
 	client_id_type get_integrated_client_id() const;
 
-	void reinfer_if_necessary_for(const compact_server_step_entropy& entropy);
+	void reinfer_if_necessary();
+	void make_sync_point();
+	void log_step_since_sync_point(const server_step_entropy&);
+	const preserialized_initial_arena_state& get_preserialized_initial_state();
 	bool server_list_enabled() const;
 	bool has_sent_any_heartbeats() const;
 	void shutdown();
@@ -327,7 +349,7 @@ public:
 				send_heartbeat_to_server_list_if_its_time();
 			}
 
-			reinfer_if_necessary_for(step_collected);
+			reinfer_if_necessary();
 
 			{
 				auto scope = measure_scope(profiler.solve_simulation);
@@ -335,11 +357,13 @@ public:
 				const auto unpacked = unpack(step_collected);
 				const auto arena = get_arena_handle();
 
+				log_step_since_sync_point(unpacked);
+
 				if (is_dedicated()) {
 					arena.advance(
 						unpacked, 
 						callbacks, 
-						solve_settings()
+						make_solve_settings()
 					);
 				}
 				else {
@@ -364,7 +388,7 @@ public:
 					arena.advance(
 						unpacked, 
 						new_callbacks, 
-						solve_settings()
+						make_solve_settings()
 					);
 
 					if (logically_set(unpacked.general.added_player)) {
@@ -421,6 +445,19 @@ public:
 
 	void sleep_until_next_tick();
 
+	/*
+		Used instead of sleep_until_next_tick if the precise_tick_scheduler var is set.
+		Returns early if a packet arrives, so that it can be received in-between ticks.
+	*/
+
+	augs::network_wait_result wait_until_next_tick(augs::network_waiter&);
+	void receive_packets_between_ticks();
+	bool uses_precise_tick_scheduler() const;
+
+	double get_secs_until_next_tick() const {
+		return server_time - get_current_time();
+	}
+
 	void update_stats(server_network_info&) const;
 
 	server_step_entropy unpack(const compact_server_step_entropy&) const;
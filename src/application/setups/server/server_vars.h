@@ -64,6 +64,9 @@ struct server_vars {
 	uint32_t max_bots = 0;
 	float log_performance_once_every_secs = 1;
 	float sleep_mult = 0.1f;
+	bool precise_tick_scheduler = true;
+	uint32_t num_logic_pool_workers = 0;
+	uint32_t max_join_catch_up_steps = 2000;
 	// END GEN INTROSPECTOR
 };
 
@@ -42,12 +42,18 @@ namespace augs {
 		}
 	};
 
-	class sound_buffer {
-		void from_file(const sound_buffer_loading_input);
+	/*
+		Decodes the sound along with all its numbered variations (_1, _2, ...).
+		Does not touch OpenAL, so it can run on any thread.
+	*/
+
+	std::vector<sound_data> decode_sound_variations(const sound_buffer_loading_input);
 
+	class sound_buffer {
 		std::vector<single_sound_buffer> variations;
 	public:
 		sound_buffer(const sound_buffer_loading_input);
+		sound_buffer(const std::vector<sound_data>& decoded_variations, sound_buffer_loading_settings);
 
 		const single_sound_buffer& get_buffer(std::size_t variation_index) const;
 
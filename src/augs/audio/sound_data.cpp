@@ -4,6 +4,8 @@
 #endif
 
 #include <cstring>
+#include <thread>
+#include <optional>
 
 #if BUILD_SOUND_FORMAT_DECODERS
 #include <ogg/ogg.h>
@@ -15,7 +17,10 @@
 #include "augs/audio/sound_data.h"
 #include "augs/ensure.h"
 #include "augs/filesystem/file.h"
-#include "augs/audio/sound_data.h"
+#include "augs/filesystem/directory.h"
+#include "augs/readwrite/byte_file.h"
+#include "augs/readwrite/byte_readwrite.h"
+#include "augs/readwrite/hashing_stream.h"
 #include "augs/build_settings/setting_log_audio_files.h"
 
 template <class T>
@@ -36,13 +41,11 @@ namespace augs {
 		const auto path_str = path.string();
 
 		if (extension == ".ogg") {
-			std::vector<char> buffer;
 			// TODO: throw if the file fails to load as OGG
 			// TODO: detect endianess
 			int endian = 0;             // 0 for Little-Endian, 1 for Big-Endian
 			int bitStream = 0xdeadbeef;
 			long bytes = 0xdeadbeef;
-			char array[OGG_BUFFER_SIZE]; 
 
 			OggVorbis_File oggFile;
 
@@ -58,13 +61,52 @@ namespace augs {
 			channels = pInfo->channels;
 			frequency = pInfo->rate;
 
+			/* 
+				Decode straight into the samples, chunk by chunk,
+				instead of growing an intermediate buffer of the whole file.
+			*/
+
+			std::size_t bytes_decoded = 0;
+
+			auto to_samples = [](const std::size_t bytes) {
+				return (bytes + sizeof(sound_sample_type) - 1) / sizeof(sound_sample_type);
+			};
+
+			auto make_room_for = [&](const std::size_t bytes_needed) {
+				if (const auto samples_needed = to_samples(bytes_needed); samples_needed > samples.size()) {
+					samples.resize(samples_needed);
+				}
+			};
+
+			const auto total_frames = ov_pcm_total(&oggFile, -1);
+			const bool total_known = total_frames > 0;
+
+			if (total_known) {
+				/* 
+					One chunk of slack since ov_read is always given a full chunk to write to.
+					Then the room made below never outgrows the reservation.
+				*/
+
+				const auto total_bytes = static_cast<std::size_t>(total_frames) * channels * sizeof(sound_sample_type);
+				samples.reserve(to_samples(total_bytes + OGG_BUFFER_SIZE));
+			}
+
 			do {
-				bytes = ov_read(&oggFile, array, OGG_BUFFER_SIZE, endian, 2, 1, &bitStream);
-				buffer.insert(buffer.end(), array, array + bytes);
+				make_room_for(bytes_decoded + OGG_BUFFER_SIZE);
+
+				auto* const output = reinterpret_cast<char*>(samples.data()) + bytes_decoded;
+				bytes = ov_read(&oggFile, output, OGG_BUFFER_SIZE, endian, 2, 1, &bitStream);
+
+				if (bytes > 0) {
+					bytes_decoded += static_cast<std::size_t>(bytes);
+				}
 			} while (bytes > 0);
 
-			samples.resize(buffer.size() / sizeof(sound_sample_type));
-			std::memcpy(samples.data(), buffer.data(), buffer.size());
+			samples.resize(bytes_decoded / sizeof(sound_sample_type));
+
+			if (!total_known) {
+				samples.shrink_to_fit();
+			}
 		}
 		else if (extension == ".wav") {
 			auto wav_file = fclosed_unique(fopen(path_str.c_str(), "rb"));
@@ -155,4 +197,146 @@ namespace augs {
 	double sound_data::compute_length_in_seconds() const {
 		return static_cast<double>(samples.size()) / (frequency * channels);
 	}
+
+	/* Bump whenever the decoded output changes, e.g. when the mono to stereo conversion is toggled. */
+	constexpr uint32_t SOUND_PCM_CACHE_VERSION = 1;
+
+	struct sound_pcm_cache_header {
+		uint32_t version = SOUND_PCM_CACHE_VERSION;
+		int32_t frequency = 0;
+		int32_t channels = 0;
+		int32_t pad = 0;
+		int64_t source_write_time = 0;
+		uint64_t source_hash = 0;
+	};
+
+	static auto get_pcm_cache_path(const path_type& source) {
+		/* 
+			Any ".." that is left after normalization is renamed,
+			so that the cache of a sound from outside of the working directory still lands in GENERATED_FILES_DIR.
+		*/
+
+		path_type within_cache;
+
+		for (const auto& part : source.lexically_normal().relative_path()) {
+			within_cache /= part == ".." ? path_type("__parent__") : part;
+		}
+
+		return path_type(GENERATED_FILES_DIR) / (within_cache.string() + ".pcm");
+	}
+
+	static uint64_t hash_file(const path_type& path) {
+		thread_local std::vector<std::byte> bytes;
+		file_to_bytes(path, bytes);
+
+		hashing_stream h;
+		h.write(bytes.data(), bytes.size());
+
+		return h.get_hash();
+	}
+
+	sound_data decode_sound_through_cache(const path_type& path) {
+		if (path.empty() || path.extension() == ".wav") {
+			/* WAVs are read as they are, there is nothing to save on. */
+			return sound_data(path);
+		}
+
+		const auto cache_path = get_pcm_cache_path(path);
+
+		sound_pcm_cache_header new_header;
+		new_header.source_write_time = static_cast<int64_t>(augs::last_write_time(path).time_since_epoch().count());
+
+		std::optional<uint64_t> source_hash;
+
+		auto calc_source_hash = [&]() {
+			if (!source_hash) {
+				source_hash = hash_file(path);
+			}
+
+			return *source_hash;
+		};
+
+		try {
+			if (augs::exists(cache_path)) {
+				auto in = open_binary_input_stream(cache_path);
+
+				sound_pcm_cache_header cached_header;
+				read_bytes(in, cached_header);
+
+				const bool cache_valid = 
+					cached_header.version == SOUND_PCM_CACHE_VERSION
+					&& (
+						cached_header.source_write_time == new_header.source_write_time
+						|| cached_header.source_hash == calc_source_hash()
+					)
+				;
+
+				if (cache_valid) {
+					sound_data result;
+					result.frequency = cached_header.frequency;
+					result.channels = cached_header.channels;
+					read_bytes(in, result.samples);
+
+					if (cached_header.source_write_time != new_header.source_write_time) {
+						/*
+							Only touched, e.g. by a checkout, as the contents are the same.
+							Remember the new time so that the next load does not hash the file again.
+						*/
+
+						cached_header.source_write_time = new_header.source_write_time;
+
+						try {
+							/* Opened for reading too, so that the samples are not truncated. */
+							auto out = with_exceptions<std::ofstream>();
+							out.open(cache_path, std::ios::in | std::ios::out | std::ios::binary);
+							write_bytes(out, cached_header);
+						}
+						catch (...) {
+							/* The samples are fine either way, the next load will just hash again. */
+						}
+					}
+
+					return result;
+				}
+			}
+		}
+		catch (...) {
+			/* A damaged cache is no different from a missing one. */
+		}
+
+		auto result = sound_data(path);
+
+		if (result.samples.empty()) {
+			return result;
+		}
+
+		/* 
+			Written under a name unique to this thread and then renamed,
+			so that no one reads a half-written cache if the same file is decoded twice at once.
+		*/
+
+		const auto thread_hash = std::hash<std::thread::id>()(std::this_thread::get_id());
+		const auto temporary_path = path_type(cache_path.string() + typesafe_sprintf(".%x.tmp", thread_hash));
+
+		try {
+			new_header.frequency = result.frequency;
+			new_header.channels = result.channels;
+			new_header.source_hash = calc_source_hash();
+
+			augs::create_directories_for(cache_path);
+
+			{
+				auto out = open_binary_output_stream(temporary_path);
+				write_bytes(out, new_header);
+				write_bytes(out, result.samples);
+			}
+
+			std::filesystem::rename(temporary_path, cache_path);
+		}
+		catch (...) {
+			augs::remove_file(temporary_path);
+		}
+
+		return result;
+	}
 }
@@ -15,8 +15,19 @@ namespace augs {
 		int frequency = 0;
 		int channels = 0;
 
+		sound_data() = default;
 		sound_data(const path_type& path);
 
 		double compute_length_in_seconds() const;
 	};
+
+	/*
+		Decoding an .ogg takes far longer than reading back its samples,
+		so decoded samples are cached in GENERATED_FILES_DIR.
+		A cached file is used as long as the source has the same write time or the same contents.
+
+		Safe to call from multiple threads at once, as long as they decode different files.
+	*/
+
+	sound_data decode_sound_through_cache(const path_type& path);
 }
\ No newline at end of file
@@ -0,0 +1,128 @@
+#if PLATFORM_WINDOWS
+#include <Windows.h>
+#undef min
+#undef max
+#elif PLATFORM_UNIX
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "augs/string/typesafe_sprintf.h"
+#include "augs/filesystem/file.h"
+#include "augs/filesystem/mapped_file.h"
+#include "augs/readwrite/byte_file.h"
+
+namespace augs {
+	static auto make_mapping_error(const path_type& path) {
+		return file_open_error(typesafe_sprintf("Failed to map %x into memory.", path));
+	}
+
+	mapped_file::mapped_file(const path_type& path) {
+#if PLATFORM_WINDOWS
+		const auto file = CreateFileW(
+			path.wstring().c_str(), 
+			GENERIC_READ, 
+			FILE_SHARE_READ, 
+			nullptr, 
+			OPEN_EXISTING, 
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, 
+			nullptr
+		);
+
+		if (file == INVALID_HANDLE_VALUE) {
+			throw make_mapping_error(path);
+		}
+
+		LARGE_INTEGER file_size;
+
+		if (!GetFileSizeEx(file, &file_size)) {
+			CloseHandle(file);
+			throw make_mapping_error(path);
+		}
+
+		num_bytes = static_cast<std::size_t>(file_size.QuadPart);
+
+		if (num_bytes == 0) {
+			CloseHandle(file);
+			return;
+		}
+
+		/* The mapping keeps the file open on its own. */
+		const auto mapping_handle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+
+		if (mapping_handle == nullptr) {
+			throw make_mapping_error(path);
+		}
+
+		const auto mapped_view = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+
+		if (mapped_view == nullptr) {
+			CloseHandle(mapping_handle);
+			throw make_mapping_error(path);
+		}
+
+		mapping = mapping_handle;
+		view = reinterpret_cast<const std::byte*>(mapped_view);
+#elif PLATFORM_UNIX
+		const auto fd = ::open(path.string().c_str(), O_RDONLY);
+
+		if (fd == -1) {
+			throw make_mapping_error(path);
+		}
+
+		struct stat file_stat;
+
+		if (::fstat(fd, &file_stat) == -1) {
+			::close(fd);
+			throw make_mapping_error(path);
+		}
+
+		num_bytes = static_cast<std::size_t>(file_stat.st_size);
+
+		if (num_bytes == 0) {
+			::close(fd);
+			return;
+		}
+
+		/* The mapping keeps the file open on its own. */
+		const auto mapped_view = ::mmap(nullptr, num_bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd);
+
+		if (mapped_view == MAP_FAILED) {
+			throw make_mapping_error(path);
+		}
+
+		mapping = mapped_view;
+		view = reinterpret_cast<const std::byte*>(mapped_view);
+#else
+		file_to_bytes(path, fallback);
+
+		num_bytes = fallback.size();
+		view = fallback.data();
+#endif
+	}
+
+	void mapped_file::unmap() {
+		if (mapping == nullptr) {
+			return;
+		}
+
+#if PLATFORM_WINDOWS
+		UnmapViewOfFile(view);
+		CloseHandle(mapping);
+#elif PLATFORM_UNIX
+		::munmap(mapping, num_bytes);
+#endif
+
+		mapping = nullptr;
+		view = nullptr;
+		num_bytes = 0;
+	}
+
+	mapped_file::~mapped_file() {
+		unmap();
+	}
+}
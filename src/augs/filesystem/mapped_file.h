@@ -0,0 +1,49 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+#include "augs/filesystem/path.h"
+#include "augs/readwrite/to_bytes.h"
+
+namespace augs {
+	/*
+		A read-only view of a whole file.
+		The file is memory-mapped, so reading it does not go through a stream
+		and pages are only brought in as they are touched.
+
+		Platforms without mapping support read the whole file into memory instead.
+		Throws file_open_error if the file cannot be opened.
+	*/
+
+	class mapped_file {
+		const std::byte* view = nullptr;
+		std::size_t num_bytes = 0;
+
+		void* mapping = nullptr;
+		std::vector<std::byte> fallback;
+
+		void unmap();
+
+	public:
+		mapped_file(const path_type& path);
+		~mapped_file();
+
+		mapped_file(const mapped_file&) = delete;
+		mapped_file& operator=(const mapped_file&) = delete;
+
+		mapped_file(mapped_file&&) = delete;
+		mapped_file& operator=(mapped_file&&) = delete;
+
+		const std::byte* data() const {
+			return view;
+		}
+
+		std::size_t size() const {
+			return num_bytes;
+		}
+
+		auto make_read_stream() const {
+			return augs::make_read_stream(view, num_bytes);
+		}
+	};
+}
@@ -0,0 +1,225 @@
+#include "augs/graphics/recording_renderer_backend.h"
+#include "augs/graphics/renderer_backend.h"
+#include "augs/graphics/renderer_command.h"
+#include "augs/templates/remove_cref.h"
+#include "augs/templates/always_false.h"
+
+namespace augs {
+	namespace graphics {
+		renderer_backend_stats& renderer_backend_stats::operator+=(const renderer_backend_stats& b) {
+			commands += b.commands;
+			drawcall_commands += b.drawcall_commands;
+			drawcalls += b.drawcalls;
+			vertices += b.vertices;
+			uploaded_bytes += b.uploaded_bytes;
+			state_changes += b.state_changes;
+			texture_binds += b.texture_binds;
+			shader_binds += b.shader_binds;
+			fbo_binds += b.fbo_binds;
+			uniform_sets += b.uniform_sets;
+			texture_uploads += b.texture_uploads;
+
+			return *this;
+		}
+
+		void recording_renderer_backend::perform(
+			renderer_backend_result& output,
+			const renderer_command* const c,
+			const std::size_t n,
+			const dedicated_buffers& dedicated
+		) {
+			auto& s = stats;
+
+			const ImDrawList* cmd_list = nullptr;
+			std::size_t cmd_i = 0;
+
+			/* 
+				Mirrors renderer_backend::perform(const drawcall_command&),
+				where consecutive drawcalls of the same kind are merged into one.
+			*/
+
+			enum class batch_kind {
+				NONE,
+				TRIANGLES,
+				TRIANGLES_WITH_SPECIALS,
+				LINES
+			};
+
+			auto current_batch = batch_kind::NONE;
+
+			auto continue_batch = [&](const batch_kind kind) {
+				if (current_batch != kind) {
+					++s.drawcalls;
+					current_batch = kind;
+				}
+			};
+
+			auto record_drawcall = [&](const drawcall_command& cmd) {
+				++s.drawcall_commands;
+
+				if (cmd.triangles) {
+					continue_batch(cmd.specials ? batch_kind::TRIANGLES_WITH_SPECIALS : batch_kind::TRIANGLES);
+
+					s.vertices += cmd.count * 3;
+					s.uploaded_bytes += sizeof(vertex_triangle) * cmd.count;
+
+					if (cmd.specials) {
+						s.uploaded_bytes += sizeof(special) * cmd.count * 3;
+					}
+				}
+
+				if (cmd.lines) {
+					continue_batch(batch_kind::LINES);
+
+					s.vertices += cmd.count * 2;
+					s.uploaded_bytes += sizeof(vertex_line) * cmd.count;
+				}
+			};
+
+			auto record_drawcall_for = [&](const triangles_and_specials& buffers) {
+				if (const auto lines_n = buffers.lines.size(); lines_n > 0) {
+					drawcall_command translated_cmd;
+
+					translated_cmd.lines = buffers.lines.data();
+					translated_cmd.count = static_cast<uint32_t>(lines_n);
+
+					record_drawcall(translated_cmd);
+				}
+
+				if (const auto triangles_n = buffers.triangles.size(); triangles_n > 0) {
+					drawcall_command translated_cmd;
+
+					translated_cmd.triangles = buffers.triangles.data();
+					translated_cmd.count = static_cast<uint32_t>(triangles_n);
+
+					if (buffers.specials.size() > 0) {
+						translated_cmd.specials = buffers.specials.data();
+					}
+
+					record_drawcall(translated_cmd);
+				}
+			};
+
+			/* Marking only remembers the current object for later, it binds nothing. */
+
+			auto binds = [](const settable_as_current_op_type op) {
+				return op != settable_as_current_op_type::MARK;
+			};
+
+			for (std::size_t i = 0; i < n; ++i) {
+				++s.commands;
+
+				auto command_handler = [&](const auto& typed_cmd) {
+					using C = remove_cref<decltype(typed_cmd)>;
+
+					constexpr bool is_drawcall = 
+						std::is_same_v<C, drawcall_command> 
+						|| std::is_same_v<C, drawcall_dedicated_command> 
+						|| std::is_same_v<C, drawcall_dedicated_vector_command>
+					;
+
+					if constexpr(!is_drawcall) {
+						current_batch = batch_kind::NONE;
+					}
+
+					if constexpr(std::is_same_v<C, drawcall_command>) {
+						record_drawcall(typed_cmd);
+					}
+					else if constexpr(std::is_same_v<C, drawcall_dedicated_command>) {
+						record_drawcall_for(dedicated[typed_cmd.type]);
+					}
+					else if constexpr(std::is_same_v<C, drawcall_dedicated_vector_command>) {
+						record_drawcall_for(dedicated[typed_cmd.type][typed_cmd.index]);
+					}
+					else if constexpr(std::is_same_v<C, setup_imgui_list>) {
+						cmd_list = typed_cmd.cmd_list;
+						cmd_i = 0;
+
+						s.uploaded_bytes += cmd_list->VtxBuffer.Size * sizeof(ImDrawVert);
+						s.uploaded_bytes += cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx);
+
+						/* The lists are owned by whoever consumes the commands, exactly as with the real backend. */
+						output.imgui_lists_to_delete.emplace_back(typed_cmd.cmd_list);
+					}
+					else if constexpr(std::is_same_v<C, make_screenshot>) {
+						output.result_screenshot.emplace(typed_cmd.bounds.get_size());
+					}
+					else if constexpr(std::is_same_v<C, no_arg_command>) {
+						using N = no_arg_command;
+
+						switch (typed_cmd) {
+							case N::FULLSCREEN_QUAD:
+								++s.drawcalls;
+								s.vertices += 6;
+								break;
+
+							case N::IMGUI_CMD:
+								++s.drawcalls;
+								s.vertices += cmd_list->CmdBuffer[cmd_i++].ElemCount;
+								break;
+
+							case N::CLEAR_CURRENT_FBO:
+							case N::CLEAR_STENCIL:
+								break;
+
+							default:
+								++s.state_changes;
+								break;
+						}
+					}
+					else if constexpr(
+						std::is_same_v<C, toggle_command>
+						|| std::is_same_v<C, set_clear_color_command>
+						|| std::is_same_v<C, set_scissor_bounds_command>
+						|| std::is_same_v<C, set_viewport_command>
+						|| std::is_same_v<C, set_active_texture_command>
+					) {
+						++s.state_changes;
+					}
+					else if constexpr(std::is_same_v<C, object_command<texture, texImage2D_command>>) {
+						++s.texture_uploads;
+						s.uploaded_bytes += typed_cmd.payload.size.area() * 4;
+					}
+					else if constexpr(std::is_same_v<C, object_command<texture, set_filtering_command>>) {
+						++s.state_changes;
+					}
+					else if constexpr(
+						std::is_same_v<C, object_command<const shader_program, set_uniform_command>>
+						|| std::is_same_v<C, object_command<const shader_program, set_projection_command>>
+					) {
+						++s.uniform_sets;
+					}
+					else if constexpr(
+						std::is_same_v<C, object_command<const texture, settable_as_current_op_type>>
+						|| std::is_same_v<C, static_object_command<const texture, settable_as_current_op_type>>
+					) {
+						if (binds(typed_cmd.payload)) {
+							++s.texture_binds;
+						}
+					}
+					else if constexpr(
+						std::is_same_v<C, object_command<const shader_program, settable_as_current_op_type>>
+						|| std::is_same_v<C, static_object_command<const shader_program, settable_as_current_op_type>>
+					) {
+						if (binds(typed_cmd.payload)) {
+							++s.shader_binds;
+						}
+					}
+					else if constexpr(
+						std::is_same_v<C, object_command<const fbo, settable_as_current_op_type>>
+						|| std::is_same_v<C, static_object_command<const fbo, settable_as_current_op_type>>
+					) {
+						if (binds(typed_cmd.payload)) {
+							++s.fbo_binds;
+						}
+					}
+					else {
+						static_assert(always_false_v<C>, "Unimplemented command type!");
+					}
+				};
+
+				std::visit(command_handler, c[i].payload);
+			}
+		}
+	}
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+
+struct renderer_backend_result;
+
+namespace augs {
+	struct dedicated_buffers;
+
+	namespace graphics {
+		struct renderer_command;
+
+		struct renderer_backend_stats {
+			std::size_t commands = 0;
+			std::size_t drawcall_commands = 0;
+
+			/* After merging consecutive drawcalls, as the renderer_backend does. */
+			std::size_t drawcalls = 0;
+
+			std::size_t vertices = 0;
+			std::size_t uploaded_bytes = 0;
+
+			/* Blending, stencil, scissor, viewport, clear color and the active texture unit. */
+			std::size_t state_changes = 0;
+
+			std::size_t texture_binds = 0;
+			std::size_t shader_binds = 0;
+			std::size_t fbo_binds = 0;
+			std::size_t uniform_sets = 0;
+			std::size_t texture_uploads = 0;
+
+			renderer_backend_stats& operator+=(const renderer_backend_stats&);
+		};
+
+		/*
+			Consumes exactly the same command stream as the renderer_backend,
+			but instead of issuing any OpenGL calls, it only counts what would have been issued.
+
+			Lets the cost of producing the commands be measured headlessly,
+			and lets any change to the rendering scripts be checked for how many drawcalls it adds or saves.
+		*/
+
+		class recording_renderer_backend {
+		public:
+			renderer_backend_stats stats;
+
+			void perform(
+				renderer_backend_result& output,
+				const renderer_command*,
+				std::size_t n,
+				const dedicated_buffers&
+			);
+		};
+	}
+}
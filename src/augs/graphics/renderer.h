@@ -1,6 +1,7 @@
 #pragma once
 #include "augs/math/vec2.h"
 #include "augs/templates/object_command.h"
+#include "augs/templates/remove_cref.h"
 
 #include "augs/graphics/rgba.h"
 #include "augs/graphics/vertex.h"
@@ -65,6 +66,7 @@ namespace augs {
 
 		std::size_t num_total_triangles_drawn = 0;
 		std::size_t num_total_lines_drawn = 0;
+		std::size_t num_total_drawcalls = 0;
 
 	public:
 		render_command_buffer commands;
@@ -119,8 +121,24 @@ namespace augs {
 			return out;
 		}
 
+		std::size_t extract_num_total_drawcalls() {
+			auto out = num_total_drawcalls;
+			num_total_drawcalls = 0;
+			return out;
+		}
+
 		template <class T>
 		void push_command(T&& t) {
+			using C = remove_cref<T>;
+
+			if constexpr(
+				std::is_same_v<C, drawcall_command>
+				|| std::is_same_v<C, drawcall_dedicated_command>
+				|| std::is_same_v<C, drawcall_dedicated_vector_command>
+			) {
+				++num_total_drawcalls;
+			}
+
 			commands.emplace_back(graphics::renderer_command { std::forward<T>(t) });
 		}
 
@@ -1,3 +1,6 @@
+#include <array>
+#include <cstring>
+
 #include "augs/log_direct.h"
 #include "augs/graphics/renderer_backend.h"
 #include "augs/graphics/OpenGL_includes.h"
@@ -39,6 +42,193 @@ template <class A, class B>
 constexpr bool same = std::is_same_v<A, B>;
 #endif
 
+#if BUILD_OPENGL
+/*
+	The vertices of all drawcall_commands are streamed into one big ring buffer,
+	so that consecutive drawcalls with nothing in between can be merged into a single glDrawArrays.
+
+	If the context supports GL 4.4, the ring is mapped once and for all, and written to directly.
+	It is then divided into regions, each guarded by a fence placed after the last draw that reads it,
+	so that no region is overwritten while the GPU might still be reading from it.
+
+	Otherwise, the ring is written with glBufferSubData and orphaned whenever it wraps around.
+*/
+
+constexpr std::size_t STREAM_RING_VERTICES = 1 << 19;
+constexpr std::size_t STREAM_RING_REGIONS = 4;
+constexpr std::size_t STREAM_RING_REGION_VERTICES = STREAM_RING_VERTICES / STREAM_RING_REGIONS;
+
+struct vertex_stream {
+	GLuint vao = 0xdeadbeef;
+	GLuint vertex_buffer_id = 0xdeadbeef;
+	GLuint special_buffer_id = 0xdeadbeef;
+
+	augs::vertex* mapped_vertices = nullptr;
+	augs::special* mapped_specials = nullptr;
+
+	std::size_t head = 0;
+
+	std::array<GLsync, STREAM_RING_REGIONS> fences = {};
+	std::array<bool, STREAM_RING_REGIONS> left_unfenced = {};
+
+	bool vao_bound = false;
+	bool specials_enabled = false;
+
+	/* The drawcalls streamed so far that will be issued as one. */
+
+	GLenum batch_mode = GL_TRIANGLES;
+	bool batch_has_specials = false;
+	std::size_t batch_first = 0;
+	std::size_t batch_count = 0;
+
+	bool is_persistent() const {
+		return mapped_vertices != nullptr;
+	}
+
+	static auto region_of(const std::size_t vertex_index) {
+		return vertex_index / STREAM_RING_REGION_VERTICES;
+	}
+
+	void wait_for_region(const std::size_t r) {
+		if (const auto fence = fences[r]) {
+			for (;;) {
+				const auto status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+
+				if (status != GL_TIMEOUT_EXPIRED) {
+					break;
+				}
+			}
+
+			GL_CHECK(glDeleteSync(fence));
+			fences[r] = nullptr;
+		}
+	}
+
+	void fence_left_regions() {
+		for (std::size_t r = 0; r < STREAM_RING_REGIONS; ++r) {
+			if (left_unfenced[r]) {
+				if (fences[r]) {
+					GL_CHECK(glDeleteSync(fences[r]));
+				}
+
+				GL_CHECK(fences[r] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+				left_unfenced[r] = false;
+			}
+		}
+	}
+
+	void leave_regions_until(const std::size_t new_head) {
+		if (!is_persistent()) {
+			return;
+		}
+
+		const auto last_written = head > 0 ? region_of(head - 1) : STREAM_RING_REGIONS;
+
+		for (auto r = region_of(head); r < STREAM_RING_REGIONS && r * STREAM_RING_REGION_VERTICES < new_head; ++r) {
+			if (r != last_written) {
+				wait_for_region(r);
+			}
+		}
+
+		for (auto r = region_of(head); r < region_of(new_head) && r < STREAM_RING_REGIONS; ++r) {
+			left_unfenced[r] = true;
+		}
+	}
+
+	void wrap_around() {
+		if (is_persistent()) {
+			left_unfenced[region_of(head - 1)] = true;
+			fence_left_regions();
+		}
+		else {
+			GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_id));
+			GL_CHECK(glBufferData(GL_ARRAY_BUFFER, sizeof(augs::vertex) * STREAM_RING_VERTICES, nullptr, GL_STREAM_DRAW));
+			GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, special_buffer_id));
+			GL_CHECK(glBufferData(GL_ARRAY_BUFFER, sizeof(augs::special) * STREAM_RING_VERTICES, nullptr, GL_STREAM_DRAW));
+		}
+
+		head = 0;
+	}
+
+	/* Specials are written at the same index as their vertices, so that both attributes are read with the same offset. */
+
+	std::size_t write(const augs::vertex* const vertices, const augs::special* const specials, const std::size_t n) {
+		const auto first = head;
+		const auto new_head = head + n;
+
+		leave_regions_until(new_head);
+
+		if (is_persistent()) {
+			std::memcpy(mapped_vertices + first, vertices, sizeof(augs::vertex) * n);
+
+			if (specials) {
+				std::memcpy(mapped_specials + first, specials, sizeof(augs::special) * n);
+			}
+		}
+		else {
+			GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_id));
+			GL_CHECK(glBufferSubData(GL_ARRAY_BUFFER, sizeof(augs::vertex) * first, sizeof(augs::vertex) * n, vertices));
+
+			if (specials) {
+				GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, special_buffer_id));
+				GL_CHECK(glBufferSubData(GL_ARRAY_BUFFER, sizeof(augs::special) * first, sizeof(augs::special) * n, specials));
+			}
+		}
+
+		head = new_head;
+		return first;
+	}
+};
+
+static void create_vertex_stream(vertex_stream& s) {
+	GL_CHECK(glGenVertexArrays(1, &s.vao));
+	GL_CHECK(glBindVertexArray(s.vao));
+
+	const bool persistent = GLAD_GL_VERSION_4_4 && glBufferStorage != nullptr;
+	const auto flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+	auto allocate = [&](GLuint& id, const std::size_t element_size) -> void* {
+		const auto size = static_cast<GLsizeiptr>(element_size * STREAM_RING_VERTICES);
+
+		GL_CHECK(glGenBuffers(1, &id));
+		GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, id));
+
+		if (persistent) {
+			GL_CHECK(glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags));
+			
+			void* mapped = nullptr;
+			GL_CHECK(mapped = glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags));
+			return mapped;
+		}
+
+		GL_CHECK(glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_STREAM_DRAW));
+		return nullptr;
+	};
+
+	s.mapped_specials = reinterpret_cast<augs::special*>(allocate(s.special_buffer_id, sizeof(augs::special)));
+	GL_CHECK(glVertexAttribPointer(static_cast<int>(vertex_attribute::special), sizeof(augs::special) / sizeof(float), GL_FLOAT, GL_FALSE, sizeof(augs::special), nullptr));
+
+	s.mapped_vertices = reinterpret_cast<augs::vertex*>(allocate(s.vertex_buffer_id, sizeof(augs::vertex)));
+
+	GL_CHECK(glEnableVertexAttribArray(static_cast<int>(vertex_attribute::position)));
+	GL_CHECK(glEnableVertexAttribArray(static_cast<int>(vertex_attribute::texcoord)));
+	GL_CHECK(glEnableVertexAttribArray(static_cast<int>(vertex_attribute::color)));
+
+	GL_CHECK(glVertexAttribPointer(static_cast<int>(vertex_attribute::position), 2, GL_FLOAT, GL_FALSE, sizeof(augs::vertex), nullptr));
+	GL_CHECK(glVertexAttribPointer(static_cast<int>(vertex_attribute::texcoord), 2, GL_FLOAT, GL_FALSE, sizeof(augs::vertex), reinterpret_cast<char*>(sizeof(float) * 2)));
+	GL_CHECK(glVertexAttribPointer(static_cast<int>(vertex_attribute::color), 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(augs::vertex), reinterpret_cast<char*>(sizeof(float) * 2 + sizeof(float) * 2)));
+
+	if (s.mapped_vertices == nullptr || s.mapped_specials == nullptr) {
+		s.mapped_vertices = nullptr;
+		s.mapped_specials = nullptr;
+	}
+
+	s.vao_bound = true;
+
+	LOG("Streaming vertices through a %x ring buffer.", s.is_persistent() ? "persistently mapped" : "sub-data");
+}
+#endif
+
 namespace augs {
 	namespace graphics {
 		struct renderer_backend::platform_data {
@@ -46,6 +236,10 @@ namespace augs {
 			GLuint special_buffer_id = 0xdeadbeef;
 			GLuint imgui_elements_id = 0xdeadbeef;
 			GLuint vao_buffer = 0xdeadbeef;
+
+#if BUILD_OPENGL
+			vertex_stream stream;
+#endif
 		};
 
 		renderer_backend::~renderer_backend() = default;
@@ -124,6 +318,9 @@ namespace augs {
 #endif
 
 #if BUILD_OPENGL
+			create_vertex_stream(platform->stream);
+			use_unstreamed_vertices();
+
 			GLint read_size = 0;
 			GL_CHECK(glGetIntegerv(GL_MAX_TEXTURE_SIZE, &read_size));
 			ensure(read_size >= 0);
@@ -137,8 +334,117 @@ namespace augs {
 			return max_texture_size;
 		}
 
+		void renderer_backend::use_unstreamed_vertices() {
+#if BUILD_OPENGL
+			auto& s = platform->stream;
+
+			if (s.vao_bound) {
+				GL_CHECK(glBindVertexArray(platform->vao_buffer));
+				s.vao_bound = false;
+			}
+#endif
+		}
+
+		void renderer_backend::flush_drawcalls() {
+#if BUILD_OPENGL
+			auto& s = platform->stream;
+
+			if (s.batch_count > 0) {
+				if (!s.vao_bound) {
+					GL_CHECK(glBindVertexArray(s.vao));
+					s.vao_bound = true;
+				}
+
+				if (s.specials_enabled != s.batch_has_specials) {
+					if (s.batch_has_specials) {
+						enable_special_vertex_attribute();
+					}
+					else {
+						disable_special_vertex_attribute();
+					}
+
+					s.specials_enabled = s.batch_has_specials;
+				}
+
+				GL_CHECK(glDrawArrays(s.batch_mode, static_cast<GLint>(s.batch_first), static_cast<GLsizei>(s.batch_count)));
+
+				s.batch_count = 0;
+			}
+
+			if (s.is_persistent()) {
+				s.fence_left_regions();
+			}
+#endif
+		}
+
 		void renderer_backend::perform(const drawcall_command& cmd) {
 #if BUILD_OPENGL
+			auto& s = platform->stream;
+
+			auto stream = [&](const GLenum mode, const vertex* const vertices, const special* const specials, const std::size_t n) {
+				if (n > STREAM_RING_REGION_VERTICES) {
+					auto piece = drawcall_command();
+
+					piece.count = cmd.count;
+
+					if (mode == GL_TRIANGLES) {
+						piece.triangles = cmd.triangles;
+						piece.specials = cmd.specials;
+					}
+					else {
+						piece.lines = cmd.lines;
+					}
+
+					flush_drawcalls();
+					perform_unstreamed(piece);
+					return;
+				}
+
+				if (s.head + n > STREAM_RING_VERTICES) {
+					flush_drawcalls();
+					s.wrap_around();
+				}
+
+				const bool has_specials = specials != nullptr;
+
+				const bool continues_batch = 
+					s.batch_count > 0
+					&& s.batch_mode == mode 
+					&& s.batch_has_specials == has_specials
+					&& s.batch_first + s.batch_count == s.head
+				;
+
+				if (!continues_batch) {
+					flush_drawcalls();
+				}
+
+				const auto first = s.write(vertices, specials, n);
+
+				if (s.batch_count == 0) {
+					s.batch_mode = mode;
+					s.batch_has_specials = has_specials;
+					s.batch_first = first;
+				}
+
+				s.batch_count += n;
+			};
+
+			if (cmd.triangles) {
+				stream(GL_TRIANGLES, cmd.triangles->vertices.data(), cmd.specials, cmd.count * 3);
+			}
+
+			if (cmd.lines) {
+				stream(GL_LINES, cmd.lines->vertices, nullptr, cmd.count * 2);
+			}
+#else
+			(void)cmd;
+#endif
+		}
+
+		void renderer_backend::perform_unstreamed(const drawcall_command& cmd) {
+#if BUILD_OPENGL
+			use_unstreamed_vertices();
+
 			const auto& p = *platform;
 
 			const auto triangles = cmd.triangles;
@@ -199,6 +505,17 @@ namespace augs {
 				auto command_handler = [&](const auto& typed_cmd) {
 					using C = remove_cref<decltype(typed_cmd)>;
 
+					constexpr bool is_drawcall = 
+						same<C, drawcall_command> 
+						|| same<C, drawcall_dedicated_command> 
+						|| same<C, drawcall_dedicated_vector_command>
+					;
+
+					if constexpr(!is_drawcall) {
+						/* Whatever is about to change, it must not affect the drawcalls merged so far. */
+						flush_drawcalls();
+					}
+
 					auto perform_drawcall_for = [&](const auto& buffers) {
 						if (const auto lines_n = buffers.lines.size(); lines_n > 0) {
 							drawcall_command translated_cmd;
@@ -242,6 +559,8 @@ namespace augs {
 						cmd_list = typed_cmd.cmd_list;
 						fb_height = typed_cmd.fb_height;
 
+						use_unstreamed_vertices();
+
 						GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, p.triangle_buffer_id));
 						buffer_data(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert), (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW);
 
@@ -322,6 +641,8 @@ namespace augs {
 
 				std::visit(command_handler, cmd.payload);
 			}
+
+			flush_drawcalls();
 #else
 			(void)c;
 			(void)n;
@@ -343,6 +664,8 @@ namespace augs {
 
 			(void)vertices;
 
+			use_unstreamed_vertices();
+
 			GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, platform->triangle_buffer_id));
 
 			GL_CHECK(glDisableVertexAttribArray(static_cast<int>(vertex_attribute::texcoord)));
@@ -65,7 +65,11 @@ namespace augs {
 			void stencil_positive_test();
 			void stencil_reverse_test();
 
+			void use_unstreamed_vertices();
+			void flush_drawcalls();
+
 			void perform(const drawcall_command&);
+			void perform_unstreamed(const drawcall_command&);
 
 		public:
 			unsigned get_max_texture_size() const;
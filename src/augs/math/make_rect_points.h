@@ -29,6 +29,16 @@ namespace augs {
 
 		v[3].y += size.y;
 
+		if (degrees == 0) {
+			/* Most particles and many sprites are unrotated - skip the trigonometry. */
+
+			for (auto& vv : v) {
+				vv += pos;
+			}
+
+			return v;
+		}
+
 		const auto radians = DEG_TO_RAD<remove_cref<decltype(degrees)>> * degrees;
 
 		real32 s = 0.f;
@@ -19,6 +19,9 @@ namespace augs {
 		T last_maximum = T();
 		T last_measurement = T();
 
+		std::size_t num_measurements = 0;
+		T total_measured = T();
+
 		bool measured = false;
 
 		struct summary_data {
@@ -41,6 +44,9 @@ namespace augs {
 			measured = true;
 			last_measurement = value;
 
+			++num_measurements;
+			total_measured += value;
+
 			tracked[measurement_index] = last_measurement;
 			++measurement_index;
 			measurement_index %= tracked.size();
@@ -81,6 +87,19 @@ namespace augs {
 			return last_measurement;
 		}
 
+		/* 
+			Never reset, so the caller can tell what was measured in-between
+			by comparing against earlier values.
+		*/
+
+		std::size_t get_num_measurements() const {
+			return num_measurements;
+		}
+
+		T get_total_units() const {
+			return total_measured;
+		}
+
 		bool was_measured() const {
 			return summary_info.measured;
 		}
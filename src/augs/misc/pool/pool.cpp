@@ -171,6 +171,117 @@ void test_pool() {
 	REQUIRE(5 == p.size());
 }
 
+struct synchronized_test_state {
+	static constexpr bool is_synchronized_solvable = true;
+	int value = 0;
+};
+
+struct synchronized_test_cache {
+	int value = 0;
+};
+
+TEST_CASE("Pool SynchronizedSolvableArrays") {
+	using sp_t = augs::pool<int, make_vector, unsigned short, type_list<synchronized_test_state, synchronized_test_cache>>;
+
+	sp_t p;
+
+	const auto a = p.allocate(1).key;
+	const auto b = p.allocate(2).key;
+	const auto c = p.allocate(3).key;
+
+	auto state_of = [](auto& pool, const auto key) -> auto& {
+		return pool.template get_corresponding<synchronized_test_state>(pool.get(key)).value;
+	};
+
+	auto cache_of = [](auto& pool, const auto key) -> auto& {
+		return pool.template get_corresponding<synchronized_test_cache>(pool.get(key)).value;
+	};
+
+	state_of(p, a) = 10;
+	state_of(p, b) = 20;
+	state_of(p, c) = 30;
+
+	cache_of(p, b) = 5;
+
+	/* The last object is moved into the freed slot, along with its synchronized elements. */
+	p.free(a);
+
+	REQUIRE(state_of(p, b) == 20);
+	REQUIRE(state_of(p, c) == 30);
+
+	std::vector<std::byte> bytes;
+
+	{
+		auto s = augs::ref_memory_stream(bytes);
+		augs::write_bytes(s, p);
+	}
+
+	sp_t q;
+
+	{
+		auto s = augs::cref_memory_stream(bytes);
+		augs::read_bytes(s, q);
+	}
+
+	REQUIRE(q.size() == 2);
+	REQUIRE(state_of(q, b) == 20);
+	REQUIRE(state_of(q, c) == 30);
+
+	/* Other synchronized arrays are only resized. */
+	REQUIRE(cache_of(q, b) == 0);
+}
+
+struct legacy_test_object {
+	int value = 0;
+	int state = 0;
+};
+
+TEST_CASE("Pool MigratedObjects") {
+	using lp_t = augs::pool<legacy_test_object, make_vector, unsigned short>;
+	using sp_t = augs::pool<int, make_vector, unsigned short, type_list<synchronized_test_state, synchronized_test_cache>>;
+
+	lp_t p;
+
+	const auto a = p.allocate(legacy_test_object { 1, 10 }).key;
+	const auto b = p.allocate(legacy_test_object { 2, 20 }).key;
+	const auto c = p.allocate(legacy_test_object { 3, 30 }).key;
+
+	p.free(a);
+
+	std::vector<std::byte> bytes;
+
+	{
+		auto s = augs::ref_memory_stream(bytes);
+		augs::write_bytes(s, p);
+	}
+
+	sp_t q;
+
+	{
+		auto s = augs::cref_memory_stream(bytes);
+
+		q.read_migrated_object_bytes<legacy_test_object>(
+			s,
+			[&q](const legacy_test_object& legacy, int& migrated, const unsigned short index) {
+				migrated = legacy.value;
+				q.get_corresponding_array<synchronized_test_state>()[index].value = legacy.state;
+			}
+		);
+
+		REQUIRE(!s.has_unread_bytes());
+	}
+
+	/* Ids stay valid across the migration. */
+	REQUIRE(q.size() == 2);
+	REQUIRE(q.dead(a));
+	REQUIRE(q.get(b) == 2);
+	REQUIRE(q.get(c) == 3);
+
+	REQUIRE(q.get_corresponding<synchronized_test_state>(q.get(b)).value == 20);
+	REQUIRE(q.get_corresponding<synchronized_test_state>(q.get(c)).value == 30);
+	REQUIRE(q.get_corresponding<synchronized_test_cache>(q.get(c)).value == 0);
+}
+
 TEST_CASE("Pool Readwrite") {
 	test_pool<augs::pool<float, of_size<100>::make_nontrivial_constant_vector, unsigned short>>();
 	test_pool<augs::pool<float, make_vector, unsigned char>>();
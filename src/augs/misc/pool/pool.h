@@ -15,6 +15,21 @@
 #include "augs/templates/per_type.h"
 
 namespace augs {
+	/*
+		Synchronized arrays usually hold state that can be inferred or is not significant,
+		so they are only resized when the pool is read.
+		An element type can declare is_synchronized_solvable to be serialized along with the pooled objects.
+	*/
+
+	template <class T, class = void>
+	struct is_synchronized_solvable : std::false_type {};
+
+	template <class T>
+	struct is_synchronized_solvable<T, std::enable_if_t<T::is_synchronized_solvable>> : std::true_type {};
+
+	template <class T>
+	constexpr bool is_synchronized_solvable_v = is_synchronized_solvable<T>::value;
+
 	template <class T, template <class> class make_container_type, class size_type, class synchronized_array_list = type_list<>, class... id_keys>
 	class pool {
 	public:
@@ -428,9 +443,28 @@ namespace augs {
 		template <class Archive>
 		void write_object_bytes(Archive& ar) const;
 
+		/* 
+			Like write_object_bytes, but skips the capacities, 
+			which may differ between machines even for identical pools.
+			Meant for hashing.
+		*/
+
+		template <class Archive>
+		void write_contents_bytes(Archive& ar) const;
+
 		template <class Archive>
 		void read_object_bytes(Archive& ar);
 
+		/*
+			Reads a pool whose objects were written as Legacy, e.g. by an older file format,
+			wherein no synchronized array was written yet.
+			migrate(const Legacy&, mapped_type&, size_type index) converts every object
+			and may fill the synchronized arrays at the same index.
+		*/
+
+		template <class Legacy, class Archive, class F>
+		void read_migrated_object_bytes(Archive& ar, F&& migrate);
+
 		template <class Archive>
 		void write_object_lua(Archive& ar) const;
 
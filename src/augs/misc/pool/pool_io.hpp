@@ -1,5 +1,6 @@
 #pragma once
 #include "augs/misc/pool/pool.h"
+#include "augs/templates/folded_finders.h"
 
 #include "augs/readwrite/byte_readwrite_declaration.h"
 #include "augs/readwrite/lua_readwrite_declaration.h"
@@ -21,6 +22,39 @@ namespace augs {
 		w(slots);
 		w(indirectors);
 		w(free_indirectors);
+
+		if constexpr(has_synchronized_arrays) {
+			synchronized_arrays.for_each_container(
+				[&](const auto& container) {
+					using V = typename remove_cref<decltype(container)>::value_type;
+
+					if constexpr(is_synchronized_solvable_v<V>) {
+						w(container);
+					}
+				}
+			);
+		}
+	}
+
+	template <class A, template <class> class B, class C, class D, class... E>
+	template <class Archive>
+	void pool<A, B, C, D, E...>::write_contents_bytes(Archive& ar) const {
+		augs::write_bytes(ar, objects);
+		augs::write_bytes(ar, slots);
+		augs::write_bytes(ar, indirectors);
+		augs::write_bytes(ar, free_indirectors);
+
+		if constexpr(has_synchronized_arrays) {
+			synchronized_arrays.for_each_container(
+				[&](const auto& container) {
+					using V = typename remove_cref<decltype(container)>::value_type;
+
+					if constexpr(is_synchronized_solvable_v<V>) {
+						augs::write_bytes(ar, container);
+					}
+				}
+			);
+		}
 	}
 
 	template <class A, template <class> class B, class C, class D, class... E>
@@ -39,10 +73,49 @@ namespace augs {
 		if constexpr(has_synchronized_arrays) {
 			synchronized_arrays.for_each_container(
 				[&](auto& container) {
+					using V = typename remove_cref<decltype(container)>::value_type;
+
+					if constexpr(is_synchronized_solvable_v<V>) {
+						r(container);
+					}
+					else {
+						container.resize(objects.size());
+					}
+				}
+			);
+		}
+	}
+
+	template <class A, template <class> class B, class C, class D, class... E>
+	template <class Legacy, class Archive, class F>
+	void pool<A, B, C, D, E...>::read_migrated_object_bytes(Archive& ar, F&& migrate) {
+		auto r = [&ar](auto& object) {
+			augs::read_capacity_bytes(ar, object);
+			augs::read_bytes(ar, object);
+		};
+
+		std::vector<Legacy> legacy_objects;
+
+		r(legacy_objects);
+		r(slots);
+		r(indirectors);
+		r(free_indirectors);
+
+		objects.clear();
+		objects.resize(legacy_objects.size());
+
+		if constexpr(has_synchronized_arrays) {
+			synchronized_arrays.for_each_container(
+				[&](auto& container) {
+					container.clear();
 					container.resize(objects.size());
 				}
 			);
 		}
+
+		for (std::size_t i = 0; i < legacy_objects.size(); ++i) {
+			migrate(legacy_objects[i], objects[i], static_cast<C>(i));
+		}
 	}
 
 	/* 
@@ -73,6 +146,28 @@ namespace augs {
 
 		into["objects"] = objects_table;
 		into["indirectors"] = indirectors_table;
+
+		if constexpr(has_synchronized_arrays) {
+			auto synchronized_table = into.create();
+
+			synchronized_arrays.for_each_container(
+				[&](const auto& container) {
+					using V = typename remove_cref<decltype(container)>::value_type;
+
+					if constexpr(is_synchronized_solvable_v<V>) {
+						auto elements_table = into.create();
+
+						for (std::size_t i = 0; i < container.size(); ++i) {
+							write_table_or_field(elements_table, container[i], static_cast<int>(i + 1));
+						}
+
+						synchronized_table[static_cast<int>(index_in_list_v<V, D> + 1)] = elements_table;
+					}
+				}
+			);
+
+			into["synchronized"] = synchronized_table;
+		}
 	}
 
 	template <class A, template <class> class B, class C, class D, class... E>
@@ -133,9 +228,33 @@ namespace augs {
 		}
 
 		if constexpr(has_synchronized_arrays) {
+			auto synchronized_table = from["synchronized"];
+
 			synchronized_arrays.for_each_container(
 				[&](auto& container) {
+					using V = typename remove_cref<decltype(container)>::value_type;
+
 					container.resize(objects.size());
+
+					if constexpr(is_synchronized_solvable_v<V>) {
+						if (!synchronized_table.valid()) {
+							return;
+						}
+
+						auto elements_table = synchronized_table[static_cast<int>(index_in_list_v<V, D> + 1)];
+
+						if (!elements_table.valid()) {
+							return;
+						}
+
+						for (std::size_t i = 0; i < container.size(); ++i) {
+							auto element_entry = elements_table[static_cast<int>(i + 1)];
+
+							if (element_entry.valid()) {
+								read_lua(element_entry, container[i]);
+							}
+						}
+					}
 				}
 			);
 		}
@@ -7,6 +7,7 @@
 namespace augs {
 	template <class derived>
 	class profiler_mixin {
+	public:
 		template <class S, class F>
 		static void for_each_measurement(F&& callback, S& s) {
 			augs::introspect(
@@ -24,7 +25,6 @@ namespace augs {
 			);
 		}
 
-	public:
 		void setup_names_of_measurements() {
 			auto& self = *static_cast<derived*>(this);
 	
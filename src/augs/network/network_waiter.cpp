@@ -0,0 +1,157 @@
+#include <thread>
+#include <algorithm>
+#include <chrono>
+
+#include "augs/log.h"
+#include "augs/network/network_waiter.h"
+
+#if PLATFORM_LINUX
+#include <cerrno>
+#include <cstdint>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <sys/prctl.h>
+#endif
+
+namespace augs {
+#if PLATFORM_LINUX
+	network_waiter::network_waiter() {
+		epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+		timer_fd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+		if (epoll_fd == -1 || timer_fd == -1) {
+			LOG("network_waiter: epoll or timerfd unavailable (errno: %x). Falling back to sleeping.", errno);
+			destroy();
+			return;
+		}
+
+		epoll_event ev = {};
+		ev.events = EPOLLIN;
+		ev.data.fd = timer_fd;
+
+		if (::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, timer_fd, &ev) == -1) {
+			LOG("network_waiter: failed to watch the timerfd (errno: %x). Falling back to sleeping.", errno);
+			destroy();
+			return;
+		}
+
+		/*
+			The default slack of 50us would otherwise be added to every deadline.
+			This only affects the calling thread, which is the one that waits.
+		*/
+
+		::prctl(PR_SET_TIMERSLACK, 1UL);
+	}
+
+	void network_waiter::destroy() {
+		if (timer_fd != -1) {
+			::close(timer_fd);
+			timer_fd = -1;
+		}
+
+		if (epoll_fd != -1) {
+			::close(epoll_fd);
+			epoll_fd = -1;
+		}
+
+		watched.clear();
+	}
+
+	bool network_waiter::is_precise() const {
+		return epoll_fd != -1;
+	}
+
+	void network_waiter::watch(const std::vector<netcode_socket_handle_t>& sockets) {
+		if (!is_precise() || sockets == watched) {
+			return;
+		}
+
+		for (const auto s : watched) {
+			::epoll_ctl(epoll_fd, EPOLL_CTL_DEL, s, nullptr);
+		}
+
+		watched.clear();
+
+		for (const auto s : sockets) {
+			epoll_event ev = {};
+			ev.events = EPOLLIN;
+			ev.data.fd = s;
+
+			if (::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, s, &ev) == -1) {
+				LOG("network_waiter: failed to watch socket %x (errno: %x).", s, errno);
+				continue;
+			}
+
+			watched.push_back(s);
+		}
+	}
+
+	network_wait_result network_waiter::wait(const double secs) {
+		if (secs <= 0.0) {
+			return network_wait_result::DEADLINE;
+		}
+
+		if (!is_precise()) {
+			std::this_thread::sleep_for(std::chrono::duration<double>(secs));
+			return network_wait_result::DEADLINE;
+		}
+
+		const auto total_ns = static_cast<long long>(secs * 1e9);
+
+		itimerspec spec = {};
+		/* A zero it_value would disarm the timer instead. */
+		spec.it_value.tv_sec = static_cast<time_t>(total_ns / 1000000000LL);
+		spec.it_value.tv_nsec = std::max(1L, static_cast<long>(total_ns % 1000000000LL));
+
+		/* Rearming also clears any expiration left over from an earlier wait. */
+		::timerfd_settime(timer_fd, 0, &spec, nullptr);
+
+		epoll_event events[8];
+		const auto n = ::epoll_wait(epoll_fd, events, 8, -1);
+
+		if (n == -1) {
+			return network_wait_result::INTERRUPTED;
+		}
+
+		auto result = network_wait_result::PACKET;
+
+		for (int i = 0; i < n; ++i) {
+			if (events[i].data.fd == timer_fd) {
+				uint64_t expirations = 0;
+				[[maybe_unused]] const auto r = ::read(timer_fd, &expirations, sizeof(expirations));
+
+				result = network_wait_result::DEADLINE;
+			}
+		}
+
+		return result;
+	}
+#else
+	network_waiter::network_waiter() = default;
+
+	void network_waiter::destroy() {
+		watched.clear();
+	}
+
+	bool network_waiter::is_precise() const {
+		return false;
+	}
+
+	void network_waiter::watch(const std::vector<netcode_socket_handle_t>& sockets) {
+		watched = sockets;
+	}
+
+	network_wait_result network_waiter::wait(const double secs) {
+		if (secs > 0.0) {
+			std::this_thread::sleep_for(std::chrono::duration<double>(secs));
+		}
+
+		return network_wait_result::DEADLINE;
+	}
+#endif
+
+	network_waiter::~network_waiter() {
+		destroy();
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <vector>
+#include "augs/network/netcode_sockets.h"
+
+namespace augs {
+	enum class network_wait_result {
+		DEADLINE,
+		PACKET,
+		INTERRUPTED
+	};
+
+	/*
+		Blocks until either a packet arrives on any of the watched sockets,
+		or until the deadline passes - whichever happens first.
+
+		On Linux, the sockets and a timerfd are waited on together with epoll,
+		so the thread wakes up exactly at the deadline instead of oversleeping by the scheduler quantum.
+		Elsewhere, it only sleeps until the deadline and never reports a packet.
+	*/
+
+	class network_waiter {
+		std::vector<netcode_socket_handle_t> watched;
+
+#if PLATFORM_LINUX
+		int epoll_fd = -1;
+		int timer_fd = -1;
+#endif
+
+		void destroy();
+
+	public:
+		network_waiter();
+		~network_waiter();
+
+		network_waiter(const network_waiter&) = delete;
+		network_waiter& operator=(const network_waiter&) = delete;
+
+		/* Whether the waits wake up on packets and are precise. */
+		bool is_precise() const;
+
+		/* Replaces the set of watched sockets. Does nothing if it has not changed. */
+		void watch(const std::vector<netcode_socket_handle_t>&);
+
+		network_wait_result wait(double secs);
+	};
+}
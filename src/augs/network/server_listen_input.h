@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <cstdint>
 #include "augs/templates/maybe.h"
 #include "augs/network/port_type.h"
 
@@ -14,7 +15,12 @@ namespace augs {
 
 	struct dedicated_server_input {
 		// GEN INTROSPECTOR struct augs::dedicated_server_input
-		bool dummy = false;
+		/*
+			Arenas beyond the first listen on the consecutive ports.
+			Each of them is ticked by its own thread.
+		*/
+
+		uint32_t num_arenas = 1;
 		// END GEN INTROSPECTOR
 	};
 }
@@ -195,7 +195,7 @@ namespace augs {
 			const Serialized* const storage,
 			const std::size_t n
 		) {
-			if constexpr(is_byte_readwrite_appropriate_v<Archive, Serialized>) {
+			if constexpr(is_byte_readwrite_appropriate_v<Archive, Serialized> && !writes_elements_specially_v<Archive, Serialized>) {
 				detail::write_raw_bytes(ar, storage, n);
 			}
 			else {
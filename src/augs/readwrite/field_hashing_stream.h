@@ -0,0 +1,106 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+#include "augs/templates/traits/is_pair.h"
+#include "augs/readwrite/memory_stream.h"
+#include "augs/readwrite/byte_readwrite.h"
+
+namespace augs {
+	/*
+		Raw memory of these may hold bytes that are not part of any value:
+		pad_bytes, implicit padding, or the unused storage of a disengaged optional.
+	*/
+
+	template <class T>
+	constexpr bool hash_field_by_field_v =
+		std::is_trivially_copyable_v<T>
+		&& !std::is_floating_point_v<T>
+		&& (has_introspect_v<T> || !std::has_unique_object_representations_v<T>)
+	;
+
+	/*
+		A byte stream that does not store anything,
+		but keeps a running 64-bit hash of everything written into it,
+		consuming whole 8-byte words instead of single bytes.
+
+		Trivially copyable structs that could contain padding
+		are not hashed as raw memory, but field by field through their introspectors,
+		skipping pad_bytes, so the result depends only on the values of the fields.
+	*/
+
+	class field_hashing_stream : public stream_position {
+		static constexpr uint64_t multiplier = 0x517cc1b727220a95ull;
+
+		uint64_t hash = 0;
+
+		void mix(const uint64_t word) {
+			hash = (((hash << 5) | (hash >> 59)) ^ word) * multiplier;
+		}
+
+	public:
+		static constexpr bool special_write_elements = true;
+
+		void write(const std::byte* data, std::size_t bytes) {
+			write_pos += bytes;
+
+			while (bytes >= sizeof(uint64_t)) {
+				uint64_t word;
+				std::memcpy(&word, data, sizeof(uint64_t));
+				mix(word);
+
+				data += sizeof(uint64_t);
+				bytes -= sizeof(uint64_t);
+			}
+
+			if (bytes > 0) {
+				uint64_t word = 0;
+				std::memcpy(&word, data, bytes);
+				mix(word);
+			}
+		}
+
+		template <class T, class = std::enable_if_t<hash_field_by_field_v<T>>>
+		void special_write(const T& storage) {
+			if constexpr(has_byte_write_overload_v<field_hashing_stream, T>) {
+				write_object_bytes(*this, storage);
+			}
+			else if constexpr(
+				is_optional_v<T>
+				|| is_variant_v<T>
+				|| is_std_array_v<T>
+				|| is_enum_array_v<T>
+				|| is_container_v<T>
+			) {
+				augs::write_bytes_no_overload(*this, storage);
+			}
+			else if constexpr(is_pair_v<T>) {
+				augs::write_bytes(*this, storage.first);
+				augs::write_bytes(*this, storage.second);
+			}
+			else if constexpr(has_introspect_v<T>) {
+				introspect(
+					[&](auto, const auto& member) {
+						using M = remove_cref<decltype(member)>;
+
+						if constexpr(!is_padding_field_v<M>) {
+							augs::write_bytes(*this, member);
+						}
+					},
+					storage
+				);
+			}
+			else {
+				/* Nothing to tell the fields apart by, so take the memory as it is */
+				write(reinterpret_cast<const std::byte*>(std::addressof(storage)), sizeof(T));
+			}
+		}
+
+		uint64_t get_hash() const {
+			return hash;
+		}
+	};
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+#include "augs/readwrite/memory_stream.h"
+
+namespace augs {
+	/*
+		A byte stream that does not store anything,
+		but keeps a running 64-bit FNV-1a hash of everything written into it.
+		The result does not depend on how the writes are split.
+	*/
+
+	class hashing_stream : public stream_position {
+		static constexpr uint64_t fnv_offset_basis = 14695981039346656037ull;
+		static constexpr uint64_t fnv_prime = 1099511628211ull;
+
+		uint64_t hash = fnv_offset_basis;
+
+	public:
+		void write(const std::byte* const data, const std::size_t bytes) {
+			auto h = hash;
+
+			for (std::size_t i = 0; i < bytes; ++i) {
+				h ^= std::to_integer<uint64_t>(data[i]);
+				h *= fnv_prime;
+			}
+
+			hash = h;
+			write_pos += bytes;
+		}
+
+		uint64_t get_hash() const {
+			return hash;
+		}
+	};
+}
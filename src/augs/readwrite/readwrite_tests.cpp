@@ -16,6 +16,8 @@
 #include "augs/math/camera_cone.h"
 #include "augs/misc/enum/enum_boolset.h"
 #include "augs/misc/constant_size_string.h"
+#include "augs/templates/maybe.h"
+#include "augs/readwrite/field_hashing_stream.h"
 
 TEST_CASE("Filesystem test") {
 	const auto& path = test_file_path;
@@ -405,5 +407,51 @@ TEST_CASE("Byte readwrite Variants and optionals") {
 		readwrite_test_cycle(v);
 	}
 }
+
+TEST_CASE("Byte readwrite Field hashing ignores padding") {
+	const auto hash_of = [](const auto& object) {
+		augs::field_hashing_stream hs;
+		augs::write_bytes(hs, object);
+		return hs.get_hash();
+	};
+
+	{
+		augs::maybe<float> a;
+		augs::maybe<float> b;
+
+		a.value = b.value = 3.5f;
+		a.is_enabled = b.is_enabled = true;
+
+		std::memset(&b.pad, 0xcd, sizeof(b.pad));
+
+		REQUIRE(hash_of(a) == hash_of(b));
+
+		b.value = 3.75f;
+		REQUIRE(hash_of(a) != hash_of(b));
+	}
+
+	{
+		std::vector<augs::maybe<uint32_t>> a(16);
+		std::vector<augs::maybe<uint32_t>> b(16);
+
+		for (std::size_t i = 0; i < a.size(); ++i) {
+			a[i] = b[i] = augs::maybe<uint32_t>(static_cast<uint32_t>(i * 1000), i % 2 == 0);
+			std::memset(&b[i].pad, 0xcd, sizeof(b[i].pad));
+		}
+
+		REQUIRE(hash_of(a) == hash_of(b));
+
+		b[7].value = 0;
+		REQUIRE(hash_of(a) != hash_of(b));
+	}
+
+	{
+		std::optional<uint32_t> a;
+		std::optional<uint32_t> b = 0xdeadbeef;
+		b.reset();
+
+		REQUIRE(hash_of(a) == hash_of(b));
+	}
+}
+#endif
 #endif
-#endif
\ No newline at end of file
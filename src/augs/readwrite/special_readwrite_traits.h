@@ -33,6 +33,27 @@ namespace augs {
 	template <class... Args>
 	constexpr bool has_special_write_v = has_special_write<type_list<Args...>>::value;
 
+	/*
+		Arrays and containers of trivially copyable elements are written as a single block of bytes,
+		bypassing special_write, unless the archive defines special_write_elements = true.
+	*/
+
+	template <class Archive, class = void>
+	struct has_special_write_elements : std::false_type 
+	{};
+
+	template <class Archive>
+	struct has_special_write_elements <
+		Archive,
+		std::enable_if_t<Archive::special_write_elements>
+	> : std::true_type 
+	{};
+
+	template <class Archive, class Serialized>
+	constexpr bool writes_elements_specially_v = 
+		has_special_write_elements<Archive>::value && has_special_write_v<Archive, Serialized>
+	;
+
 	template <class... Args>
 	constexpr bool has_special_readwrites_v = 
 		has_special_read_v<Args...> && has_special_write_v<Args...>
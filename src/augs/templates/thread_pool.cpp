@@ -0,0 +1,37 @@
+#if BUILD_UNIT_TESTS
+#include <array>
+#include <vector>
+#include <Catch/single_include/catch2/catch.hpp>
+#include "augs/templates/thread_pool.h"
+
+TEST_CASE("ThreadPool CompletesAllTasks") {
+	for (const std::size_t num_workers : { 0u, 1u, 3u }) {
+		augs::thread_pool pool(num_workers);
+
+		for (int n = 0; n < 40; ++n) {
+			std::vector<int> results(n, -1);
+
+			/* Exceeds the in-place storage, so it exercises the heap fallback. */
+			std::array<char, 256> big_capture = {};
+
+			for (int i = 0; i < n; ++i) {
+				if (i % 3 == 0) {
+					pool.enqueue([&results, i, big_capture]() { results[i] = i + big_capture[0]; });
+				}
+				else {
+					pool.enqueue([&results, i]() { results[i] = i; });
+				}
+			}
+
+			pool.submit();
+			pool.help_until_no_tasks();
+			pool.wait_for_all_tasks_to_complete();
+
+			for (int i = 0; i < n; ++i) {
+				REQUIRE(results[i] == i);
+			}
+		}
+	}
+}
+
+#endif
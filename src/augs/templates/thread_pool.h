@@ -1,20 +1,187 @@
 #pragma once
+#include <new>
 #include <vector>
 #include <thread>
 #include <mutex>
 #include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
 #include <condition_variable>
-#include <functional>
+
+#include "augs/ensure.h"
 
 namespace augs {
+	/*
+		A type-erased void() callable that stores small callables in-place,
+		so that enqueuing a job does not allocate.
+		Callables that do not fit are still supported, but are allocated on the heap.
+	*/
+
+	class thread_pool_task {
+		static constexpr std::size_t inplace_bytes = 128;
+
+		using storage_type = std::aligned_storage_t<inplace_bytes, alignof(std::max_align_t)>;
+
+		struct operations {
+			void (*call)(void*);
+			void (*move_to)(void* from, void* to);
+			void (*destroy)(void*);
+		};
+
+		template <class F>
+		static constexpr bool fits_inplace_v =
+			sizeof(F) <= inplace_bytes
+			&& alignof(F) <= alignof(std::max_align_t)
+			&& std::is_nothrow_move_constructible_v<F>
+		;
+
+		template <class F>
+		static const operations* get_operations() {
+			if constexpr(fits_inplace_v<F>) {
+				static const operations ops = {
+					[](void* s) { (*reinterpret_cast<F*>(s))(); },
+					[](void* from, void* to) {
+						auto& f = *reinterpret_cast<F*>(from);
+						new (to) F(std::move(f));
+						f.~F();
+					},
+					[](void* s) { reinterpret_cast<F*>(s)->~F(); }
+				};
+
+				return &ops;
+			}
+			else {
+				static const operations ops = {
+					[](void* s) { (**reinterpret_cast<F**>(s))(); },
+					[](void* from, void* to) { *reinterpret_cast<F**>(to) = *reinterpret_cast<F**>(from); },
+					[](void* s) { delete *reinterpret_cast<F**>(s); }
+				};
+
+				return &ops;
+			}
+		}
+
+		storage_type storage;
+		const operations* ops = nullptr;
+
+	public:
+		thread_pool_task() = default;
+
+		template <class F, class = std::enable_if_t<!std::is_same_v<std::decay_t<F>, thread_pool_task>>>
+		thread_pool_task(F&& f) {
+			using T = std::decay_t<F>;
+
+			if constexpr(fits_inplace_v<T>) {
+				new (&storage) T(std::forward<F>(f));
+			}
+			else {
+				*reinterpret_cast<T**>(&storage) = new T(std::forward<F>(f));
+			}
+
+			ops = get_operations<T>();
+		}
+
+		thread_pool_task(thread_pool_task&& b) noexcept {
+			if (b.ops) {
+				b.ops->move_to(&b.storage, &storage);
+				ops = b.ops;
+				b.ops = nullptr;
+			}
+		}
+
+		thread_pool_task& operator=(thread_pool_task&& b) noexcept {
+			if (this != &b) {
+				reset();
+
+				if (b.ops) {
+					b.ops->move_to(&b.storage, &storage);
+					ops = b.ops;
+					b.ops = nullptr;
+				}
+			}
+
+			return *this;
+		}
+
+		thread_pool_task(const thread_pool_task&) = delete;
+		thread_pool_task& operator=(const thread_pool_task&) = delete;
+
+		~thread_pool_task() {
+			reset();
+		}
+
+		void reset() {
+			if (ops) {
+				ops->destroy(&storage);
+				ops = nullptr;
+			}
+		}
+
+		void operator()() {
+			ops->call(&storage);
+		}
+	};
+
+	/*
+		Tasks are enqueued by a single thread and published in batches with submit().
+
+		Every worker gets its own contiguous range of the batch and consumes it from the front.
+		Once it runs dry, it steals from the back of the other ranges.
+		There is one additional range for the threads that only help (e.g. the main thread),
+		so that a pool with no workers still completes all tasks.
+
+		Claiming a task is a single compare-and-swap on the range,
+		so no lock is taken while working through a batch.
+	*/
+
 	class thread_pool {
+		struct alignas(64) task_range {
+			/* Head index in the low 32 bits, tail index in the high 32 bits. */
+			std::atomic<uint64_t> bounds = 0;
+
+			static uint64_t pack(const uint32_t head, const uint32_t tail) {
+				return static_cast<uint64_t>(head) | (static_cast<uint64_t>(tail) << 32);
+			}
+
+			void set(const uint32_t head, const uint32_t tail) {
+				bounds.store(pack(head, tail), std::memory_order_release);
+			}
+
+			bool try_take(const bool from_back, uint32_t& taken_index) {
+				auto current = bounds.load(std::memory_order_acquire);
+
+				for (;;) {
+					const auto head = static_cast<uint32_t>(current);
+					const auto tail = static_cast<uint32_t>(current >> 32);
+
+					if (head >= tail) {
+						return false;
+					}
+
+					const auto next = from_back ? pack(head, tail - 1) : pack(head + 1, tail);
+
+					if (bounds.compare_exchange_weak(current, next, std::memory_order_acq_rel, std::memory_order_acquire)) {
+						taken_index = from_back ? tail - 1 : head;
+						return true;
+					}
+				}
+			}
+		};
+
 		std::vector<std::thread> workers;
-		std::vector<std::function<void()>> tasks;
-		std::vector<std::function<void()>> cold_tasks;
+		std::vector<thread_pool_task> tasks;
+		std::vector<thread_pool_task> cold_tasks;
+
+		std::unique_ptr<task_range[]> ranges;
+		std::size_t num_ranges = 0;
 
-		int tasks_completed = 0;
+		std::atomic<int> tasks_remaining = 0;
 		int tasks_posted = 0;
 
+		uint64_t batch_counter = 0;
+
 		std::mutex queue_mutex;
 		std::condition_variable cv;
 
@@ -31,36 +198,65 @@ namespace augs {
 			return std::unique_lock<std::mutex>(completion_mutex);
 		}
 
-		void register_completion() {
-			{
+		std::size_t get_helpers_range_index() const {
+			return num_ranges - 1;
+		}
+
+		void run_task(const uint32_t index) {
+			auto& task = tasks[index];
+
+			task();
+			task.reset();
+
+			if (tasks_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
 				auto lock = lock_completion();
-				++tasks_completed;
+				completion_variable.notify_all();
+			}
+		}
+
+		void work_until_no_tasks(const std::size_t own_range_index) {
+			uint32_t index = 0;
+
+			while (ranges[own_range_index].try_take(false, index)) {
+				run_task(index);
+			}
+
+			for (;;) {
+				bool stolen = false;
+
+				for (std::size_t i = 1; i < num_ranges; ++i) {
+					auto& victim = ranges[(own_range_index + i) % num_ranges];
 
-				if (tasks_completed == tasks_posted) {
-					completion_variable.notify_all();
+					if (victim.try_take(true, index)) {
+						run_task(index);
+						stolen = true;
+						break;
+					}
+				}
+
+				if (!stolen) {
+					return;
 				}
 			}
 		}
 
-		auto make_continuous_worker() {
-			return [this] {
-				for (;;) {
-					std::function<void()> task;
+		auto make_continuous_worker(const std::size_t own_range_index, const uint64_t initial_batch) {
+			return [this, own_range_index, initial_batch] {
+				auto last_batch = initial_batch;
 
+				for (;;) {
 					{
 						auto lock = lock_queue();
-						cv.wait(lock, [this]{ return shall_quit || !tasks.empty(); });
+						cv.wait(lock, [this, last_batch]{ return shall_quit || batch_counter != last_batch; });
 
-						if (shall_quit.load() && tasks.empty()) {
-							return;
-						}
-
-						task = std::move(tasks.back());
-						tasks.pop_back();
+						last_batch = batch_counter;
 					}
 
-					task();
-					register_completion();
+					work_until_no_tasks(own_range_index);
+
+					if (shall_quit.load()) {
+						return;
+					}
 				}
 			};
 		}
@@ -76,7 +272,11 @@ namespace augs {
 				return;
 			}
 
-			shall_quit.store(true);
+			{
+				auto lock = lock_queue();
+				shall_quit.store(true);
+			}
+
 			cv.notify_all();
 			join_all();
 			workers.clear();
@@ -95,8 +295,11 @@ namespace augs {
 			quit_all_workers();
 			shall_quit.store(false);
 
+			num_ranges = num_workers + 1;
+			ranges = std::make_unique<task_range[]>(num_ranges);
+
 			for (std::size_t i = 0; i < num_workers; ++i) {
-				workers.emplace_back(make_continuous_worker());
+				workers.emplace_back(make_continuous_worker(i, batch_counter));
 			}
 		}
 
@@ -106,19 +309,37 @@ namespace augs {
 		}
 
 		void submit() {
+			ensure(tasks_remaining.load() == 0);
+
+			std::swap(cold_tasks, tasks);
+			cold_tasks.clear();
+
+			const auto n = static_cast<uint32_t>(tasks.size());
+
 			{
-				auto lock = lock_queue();
-				ensure(tasks.empty());
-				std::swap(cold_tasks, tasks);
+				auto lock = lock_completion();
+				tasks_posted = static_cast<int>(n);
+				tasks_remaining.store(static_cast<int>(n), std::memory_order_release);
+			}
+
+			{
+				const auto per_range = n / static_cast<uint32_t>(num_ranges);
+				const auto remainder = n % static_cast<uint32_t>(num_ranges);
 
-				{
-					auto lock = lock_completion();
-					tasks_completed = 0;
-					tasks_posted = tasks.size();
+				uint32_t head = 0;
+
+				for (std::size_t i = 0; i < num_ranges; ++i) {
+					const auto tail = head + per_range + (i < remainder ? 1 : 0);
+					ranges[i].set(head, tail);
+					head = tail;
 				}
 			}
 
-			cold_tasks.clear();
+			{
+				auto lock = lock_queue();
+				++batch_counter;
+			}
+
 			completion_variable.notify_all();
 			cv.notify_all();
 		}
@@ -133,29 +354,12 @@ namespace augs {
 		}
 
 		void help_until_no_tasks() {
-			for (;;) {
-				std::function<void()> task;
-
-				{
-					auto lock = lock_queue();
-
-					if (tasks.empty()) {
-						return;
-					}
-
-					task = std::move(tasks.back());
-					tasks.pop_back();
-				}
-
-				task();
-				register_completion();
-			}
+			work_until_no_tasks(get_helpers_range_index());
 		}
 
 		void wait_for_all_tasks_to_complete() {
 			auto lock = lock_completion();
-			completion_variable.wait(lock, [this]{ return tasks_posted == tasks_completed; });
+			completion_variable.wait(lock, [this]{ return tasks_remaining.load(std::memory_order_acquire) == 0; });
 		}
 	};
 }
-
@@ -0,0 +1,79 @@
+#pragma once
+#include <memory>
+#include <optional>
+
+#include "game/modes/all_mode_includes.h"
+
+#include "application/intercosm.h"
+#include "game/modes/round_template.h"
+#include "application/predefined_rulesets.h"
+#include "application/arena/mode_and_rules.h"
+#include "application/arena/arena_utils.h"
+#include "application/network/network_common.h"
+#include "application/setups/server/server_vars.h"
+#include "application/arena/choose_arena.h"
+
+/*
+	An arena loaded exactly as the server would load it, for the headless benchmarks.
+
+	Nobody controls any character, so whatever happens in it comes from the bots of the ruleset.
+	The simulation is deterministic, so two runs with the same settings see the same frames.
+*/
+
+struct benchmark_arena {
+	/* Heap-allocated as the intercosm is big. */
+
+	const std::unique_ptr<intercosm> scene = std::make_unique<intercosm>();
+	online_mode_and_rules current_mode;
+	predefined_rulesets rulesets;
+	cosmos_solvable_significant initial_signi;
+	round_template round_start_template;
+
+	auto get_handle() {
+		return online_arena_handle<false> {
+			current_mode,
+			*scene,
+			scene->world,
+			rulesets,
+			initial_signi,
+			std::addressof(round_start_template)
+		};
+	}
+
+	/* Returns the reason of the failure, if any. */
+
+	std::optional<std::string> load(sol::state& lua, const std::string& name, const int bots) {
+		const auto arena = get_handle();
+
+		try {
+			auto vars = server_solvable_vars();
+			vars.current_arena = name;
+
+			::choose_arena(lua, arena, vars, initial_signi);
+		}
+		catch (const std::exception& err) {
+			return std::string(err.what());
+		}
+
+		if (bots >= 0) {
+			arena.on_mode_with_rules(
+				[&](const auto& typed_mode, auto& rules) {
+					using M = remove_cref<decltype(typed_mode)>;
+
+					if constexpr(std::is_same_v<M, bomb_defusal>) {
+						rules.bot_quota = static_cast<unsigned>(bots);
+
+						while (rules.bot_names.size() < rules.bot_quota) {
+							rules.bot_names.push_back(typesafe_sprintf("Bot %x", rules.bot_names.size() + 1));
+						}
+					}
+					else {
+						LOG("The chosen mode has no bots. Ignoring the bot count.");
+					}
+				}
+			);
+		}
+
+		return std::nullopt;
+	}
+};
@@ -81,6 +81,16 @@ Options:
                                 Contrary to the --dedicated-server option, this lets you play on your own server within the same game instance.
     --dedicated-server          The same as --server, but applies some settings suitable for a dedicated server instance.
                                 For example - the game will be started without a window.
+    --benchmark-ticks N         Advance an arena by N logic steps without a window, audio or renderer, then quit.
+                                Per-system step timings are written as JSON to logs/tick_benchmark.json.
+    --benchmark-frames N        Render N frames of an arena through a backend that only counts the issued commands, then quit.
+                                The GPU draws nothing, but the shaders and framebuffers are still created, so a window is opened
+                                unless the game was built without OpenGL. The report is written as JSON to logs/render_benchmark.json.
+    --benchmark-ticks-per-frame N
+                                How many logic steps to advance between the benchmarked frames. 1 by default.
+    --benchmark-arena NAME      The arena to benchmark. If omitted, the default test scene is used.
+    --benchmark-bots N          Override the bot quota of the arena's ruleset.
+    --benchmark-report PATH     Write the JSON report to PATH instead.
 
 If editor_file_path is supplied and it is a directory,
 the game will automatically launch the editor to try and open the project inside it, if there is one. 
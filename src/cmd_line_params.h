@@ -17,6 +17,13 @@ struct cmd_line_params {
 	bool should_connect = false;
 	bool keep_cwd = false;
 	int test_fp_consistency = -1;
+
+	int benchmark_ticks = -1;
+	int benchmark_frames = -1;
+	int benchmark_ticks_per_frame = 1;
+	int benchmark_bots = -1;
+	std::string benchmark_arena;
+	augs::path_type benchmark_report;
 	std::string connect_address;
 
 	bool disallow_nat_traversal = false;
@@ -65,6 +72,24 @@ struct cmd_line_params {
 				test_fp_consistency = std::atoi(argv[i++]);
 				keep_cwd = true;
 			}
+			else if (a == "--benchmark-ticks") {
+				benchmark_ticks = std::atoi(argv[i++]);
+			}
+			else if (a == "--benchmark-frames") {
+				benchmark_frames = std::atoi(argv[i++]);
+			}
+			else if (a == "--benchmark-ticks-per-frame") {
+				benchmark_ticks_per_frame = std::atoi(argv[i++]);
+			}
+			else if (a == "--benchmark-bots") {
+				benchmark_bots = std::atoi(argv[i++]);
+			}
+			else if (a == "--benchmark-arena") {
+				benchmark_arena = argv[i++];
+			}
+			else if (a == "--benchmark-report") {
+				benchmark_report = argv[i++];
+			}
 			else if (a == "--nat-punch-port") {
 				first_udp_command_port = std::atoi(argv[i++]);
 			}
@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 #include <array>
+#include <memory>
 
 #include "game/cosmos/entity_id.h"
 #include "game/cosmos/entity_handle_declaration.h"
@@ -67,7 +68,13 @@ public:
 			SELECTOR,
 		} mode = type::SELECTOR;
 
-		std::vector<node> children;
+		/* Behaviours override the callbacks, so the children are held by pointer. */
+		std::vector<std::unique_ptr<node>> children;
+
+		node() = default;
+		node(const node&) = delete;
+		node& operator=(const node&) = delete;
+		virtual ~node() = default;
 
 		node* create_branches();
 
@@ -100,7 +107,7 @@ private:
 		f(p);
 
 		for (auto& child : p.children) {
-			call_on_node_recursively(child, f);
+			call_on_node_recursively(*child, f);
 		}
 	}
 };
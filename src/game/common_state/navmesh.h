@@ -0,0 +1,154 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cmath>
+
+#include "augs/math/vec2.h"
+#include "augs/math/rects.h"
+
+using navmesh_cell_index = uint32_t;
+constexpr navmesh_cell_index NAVMESH_NO_CELL = static_cast<navmesh_cell_index>(-1);
+
+/*
+	The edge shared by two neighbouring cells.
+	As seen when walking from the cell that owns the portal into the "to" cell,
+	"left" is the endpoint on the left hand and "right" the one on the right hand.
+*/
+
+struct navmesh_portal {
+	// GEN INTROSPECTOR struct navmesh_portal
+	navmesh_cell_index to = NAVMESH_NO_CELL;
+	vec2 left;
+	vec2 right;
+	// END GEN INTROSPECTOR
+
+	vec2 get_center() const {
+		return (left + right) / 2;
+	}
+
+	bool operator==(const navmesh_portal& b) const {
+		return to == b.to && left == b.left && right == b.right;
+	}
+};
+
+struct navmesh_cell {
+	// GEN INTROSPECTOR struct navmesh_cell
+	ltrb bounds;
+	uint32_t first_portal = 0;
+	uint32_t num_portals = 0;
+	// END GEN INTROSPECTOR
+
+	bool operator==(const navmesh_cell& b) const {
+		return bounds == b.bounds && first_portal == b.first_portal && num_portals == b.num_portals;
+	}
+};
+
+/*
+	The walkable area of an arena, baked once from its static fixtures.
+
+	Cells are axis-aligned rectangles wherein the center of a character can stand
+	without touching any static obstacle.
+	The grid maps every square of grid_cell_size pixels to the cell that covers it,
+	so that a point is located in constant time.
+*/
+
+struct navigation_mesh {
+	// GEN INTROSPECTOR struct navigation_mesh
+	vec2 origin;
+	real32 grid_cell_size = 0.f;
+	uint32_t grid_width = 0;
+	uint32_t grid_height = 0;
+	std::vector<navmesh_cell_index> grid;
+	std::vector<navmesh_cell> cells;
+	std::vector<navmesh_portal> portals;
+	bool baked = false;
+	// END GEN INTROSPECTOR
+
+	/*
+		An arena without any static obstacle bakes into a navmesh without cells,
+		so emptiness does not tell whether the arena was baked at all.
+	*/
+
+	bool is_baked() const {
+		return baked;
+	}
+
+	bool has_cells() const {
+		return !cells.empty();
+	}
+
+	navmesh_cell_index get_cell_at_grid(const int x, const int y) const {
+		if (x < 0 || y < 0 || x >= static_cast<int>(grid_width) || y >= static_cast<int>(grid_height)) {
+			return NAVMESH_NO_CELL;
+		}
+
+		return grid[y * grid_width + x];
+	}
+
+	navmesh_cell_index get_cell_at(const vec2 pos) const {
+		if (!has_cells()) {
+			return NAVMESH_NO_CELL;
+		}
+
+		const auto local = (pos - origin) / grid_cell_size;
+
+		return get_cell_at_grid(
+			static_cast<int>(std::floor(local.x)),
+			static_cast<int>(std::floor(local.y))
+		);
+	}
+
+	/*
+		Characters pushed against a wall stand outside of any cell,
+		so their position is resolved to the closest cell within max_grid_distance squares.
+	*/
+
+	navmesh_cell_index find_nearest_cell(const vec2 pos, const int max_grid_distance) const {
+		if (const auto direct = get_cell_at(pos); direct != NAVMESH_NO_CELL || !has_cells()) {
+			return direct;
+		}
+
+		const auto local = (pos - origin) / grid_cell_size;
+		const auto cx = static_cast<int>(std::floor(local.x));
+		const auto cy = static_cast<int>(std::floor(local.y));
+
+		auto best = NAVMESH_NO_CELL;
+		auto best_dist = 0.f;
+
+		for (int r = 1; r <= max_grid_distance; ++r) {
+			auto consider = [&](const int x, const int y) {
+				const auto candidate = get_cell_at_grid(x, y);
+
+				if (candidate == NAVMESH_NO_CELL) {
+					return;
+				}
+
+				auto closest = pos;
+				cells[candidate].bounds.snap_point(closest);
+
+				const auto dist = (closest - pos).length_sq();
+
+				if (best == NAVMESH_NO_CELL || dist < best_dist) {
+					best = candidate;
+					best_dist = dist;
+				}
+			};
+
+			for (int i = -r; i <= r; ++i) {
+				consider(cx + i, cy - r);
+				consider(cx + i, cy + r);
+			}
+
+			for (int i = -r + 1; i <= r - 1; ++i) {
+				consider(cx - r, cy + i);
+				consider(cx + r, cy + i);
+			}
+
+			if (best != NAVMESH_NO_CELL) {
+				return best;
+			}
+		}
+
+		return NAVMESH_NO_CELL;
+	}
+};
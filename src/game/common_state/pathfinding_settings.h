@@ -1,9 +1,17 @@
 #pragma once
-#include "augs/pad_bytes.h"
+#include <cstdint>
+#include "augs/math/declare_math.h"
 
 struct pathfinding_settings {
 	// GEN INTROSPECTOR struct pathfinding_settings
-	float epsilon_distance_visible_point = 2.f;
-	float epsilon_distance_the_same_vertex = 50.f;
+	real32 navmesh_cell_size = 32.f;
+	real32 agent_radius = 32.f;
+
+	uint32_t max_expanded_cells_per_step = 4096;
+	uint32_t max_expanded_cells_per_query = 1024;
+
+	real32 waypoint_reached_distance = 24.f;
+	real32 repath_target_distance = 64.f;
+	real32 repath_deviation_distance = 96.f;
 	// END GEN INTROSPECTOR
-};
\ No newline at end of file
+};
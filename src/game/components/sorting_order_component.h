@@ -10,6 +10,9 @@
 
 namespace components {
 	struct sorting_order {
+		/* Static render chunks cache the orders of static decorations until the next reinference */
+		static constexpr bool reinfer_when_tweaking = true;
+
 		// GEN INTROSPECTOR struct components::sorting_order
 		sorting_order_type order = 0;
 		// END GEN INTROSPECTOR
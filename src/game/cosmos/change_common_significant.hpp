@@ -20,5 +20,6 @@ void cosmos::change_common_significant(F&& callback) {
 		}
 	});
 
-	status = callback(common.significant);
+	auto handle = common.get_for_change();
+	status = callback(*handle);
 }
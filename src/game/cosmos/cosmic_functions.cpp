@@ -16,11 +16,36 @@
 #include "game/inferred_caches/flavour_id_cache.hpp"
 #include "game/inferred_caches/physics_world_cache.hpp"
 #include "game/cosmos/just_create_entity_functional.h"
+#include "game/cosmos/never_changes_in_game.h"
+#include "game/organization/for_each_entity_type.h"
 
 void cosmic::set_flavour_id_cache_enabled(const bool flag, cosmos& cosm) {
 	cosm.get_solvable_inferred({}).flavour_ids.enabled = flag;
 }
 
+void cosmic::copy_solvable_changing_in_game(cosmos& to_cosm, const cosmos& from_cosm) {
+	auto& to = to_cosm.get_solvable({});
+	const auto& from = from_cosm.get_solvable();
+
+	auto& to_signi = to.significant;
+	const auto& from_signi = from.significant;
+
+	for_each_entity_type([&](auto e) {
+		using E = decltype(e);
+
+		if constexpr(!never_changes_in_game_v<E>) {
+			to_signi.get_pool<E>() = from_signi.get_pool<E>();
+		}
+	});
+
+	to_signi.clk = from_signi.clk;
+	to_signi.specific_names = from_signi.specific_names;
+	to_signi.global = from_signi.global;
+	to_signi.assignment_detector = from_signi.assignment_detector;
+
+	to.inferred = from.inferred;
+}
+
 void cosmic::after_solvable_copy(cosmos& to, const cosmos& from) {
 	to.get_solvable_inferred({}).physics.clone_from(from.get_solvable_inferred().physics, to, from);
 }
@@ -336,6 +361,7 @@ ref_typed_entity_handle<entity_type> cosmic::specific_clone_entity(const ref_typ
 
 		/* Initial copy-assignment */
 		new_components = source_components; 
+		cosmic::assign_components(new_entity, cosmic::get_hot_components(source_entity));
 
 		cosmic::make_suitable_for_cloning(new_solvable);
 
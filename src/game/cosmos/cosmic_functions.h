@@ -4,6 +4,7 @@
 #include "game/cosmos/entity_handle_declaration.h"
 #include "game/cosmos/entity_id_declaration.h"
 #include "game/cosmos/specific_entity_handle_declaration.h"
+#include "game/cosmos/entity_type_traits.h"
 #include "game/common_state/entity_name_str.h"
 
 class cosmic_delta;
@@ -70,9 +71,17 @@ public:
 		C& cosm,
 		const I undo_delete_input,
 		const entity_solvable<E>& deleted_content,
+		const make_hot_components<E>& deleted_hot_content,
 		const reinference_type reinference
 	);
 
+	/* Copies components of any storage into the entity_solvable and the hot arrays alike. */
+	template <class H, class I>
+	static void assign_components(const H& handle, const I& components);
+
+	template <class H>
+	static auto get_hot_components(const H& handle);
+
 	template <class E>
 	static void make_suitable_for_cloning(entity_solvable<E>& solvable);
 
@@ -95,6 +104,7 @@ public:
 	template <template <class> class Predicate = always_true, class C, class F>
 	static void for_each_entity(C& self, F callback);
 
+	static void copy_solvable_changing_in_game(cosmos&, const cosmos&);
 	static void after_solvable_copy(cosmos&, const cosmos&);
 	static void set_flavour_id_cache_enabled(bool flag, cosmos&);
 };
@@ -1,5 +1,4 @@
 #include "augs/ensure_rel.h"
-#include "3rdparty/crc32/crc32.h"
 
 #include "augs/readwrite/memory_stream.h"
 
@@ -58,24 +57,13 @@ const cosmos cosmos::zero = {};
 
 template <class T>
 T cosmos::calculate_solvable_signi_hash() const {
-	if constexpr(std::is_same_v<T, uint32_t>) {
-		augs::memory_stream ss;
+	const auto full = calculate_solvable_signi_digest().combined();
 
-		augs::write_bytes(ss, get_clock().now);
-		augs::write_bytes(ss, get_entities_count());
-
-		for_each_having<components::sentience>(
-			[&](const auto& it) {
-				const auto& b = it.template get<components::rigid_body>();
-				const auto& c = b.get_raw_component().physics_transforms.m_xf;
-				const auto& s = it.template get<components::sentience>();
-
-				augs::write_bytes(ss, c);
-				augs::write_bytes(ss, s.meters);
-			}
-		);
-
-		return crc32buf(reinterpret_cast<char*>(ss.data()), ss.get_write_pos());
+	if constexpr(std::is_same_v<T, uint64_t>) {
+		return full;
+	}
+	else if constexpr(std::is_same_v<T, uint32_t>) {
+		return static_cast<uint32_t>(full ^ (full >> 32));
 	}
 	else {
 		static_assert(always_false_v<T>, "Unsupported hash type.");
@@ -85,6 +73,7 @@ T cosmos::calculate_solvable_signi_hash() const {
 }
 
 template uint32_t cosmos::calculate_solvable_signi_hash() const;
+template uint64_t cosmos::calculate_solvable_signi_hash() const;
 
 std::string cosmos::summary() const {
 	return typesafe_sprintf("Entities: %x\n", get_entities_count());
@@ -162,3 +151,8 @@ void cosmos::assign_solvable(const cosmos& b) {
 
 	cosmic::after_solvable_copy(*this, b);
 }
+
+void cosmos::assign_solvable_changing_in_game(const cosmos& b) {
+	cosmic::copy_solvable_changing_in_game(*this, b);
+	cosmic::after_solvable_copy(*this, b);
+}
@@ -10,6 +10,7 @@
 #include "game/cosmos/private_cosmos_solvable.h"
 #include "game/cosmos/entity_id.h"
 #include "game/cosmos/handle_getters_declaration.h"
+#include "game/cosmos/solvable_signi_digest.h"
 
 #include "game/enums/processing_subjects.h"
 
@@ -71,15 +72,20 @@ public:
 	std::string summary() const;
 
 	const cosmos_common_significant& get_common_significant() const {
-		return common.significant;
+		return common.get();
 	}
 
+	/* 
+		Only for the editor's commands, which change a single field right away.
+		Anything longer should go through change_common_significant.
+	*/
+
 	cosmos_common_significant& get_common_significant(cosmos_common_significant_access) {
-		return common.significant;
+		return *common.get_for_change();
 	}
 
 	const cosmos_common_significant& get_common_significant(cosmos_common_significant_access) const {
-		return common.significant;
+		return common.get();
 	}
 
 	const common_assets& get_common_assets() const {
@@ -308,9 +314,19 @@ public:
 
 	void assign_solvable(const cosmos& b);
 
+	/*
+		Like assign_solvable, but skips the pools of the entity types that never change in game.
+		Both cosmoses must have started from the same solvable, 
+		e.g. the predicted and the referential cosmos of a client.
+	*/
+
+	void assign_solvable_changing_in_game(const cosmos& b);
+
 	template <class T>
 	T calculate_solvable_signi_hash() const;
 
+	solvable_signi_digest calculate_solvable_signi_digest() const;
+
 	cosmos_id_type get_cosmos_id() const {
 		return cosmos_id;
 	}
@@ -1,5 +1,48 @@
 #include "game/cosmos/cosmos_common.h"
 
+cosmos_common::write_handle::write_handle(cosmos_common& owner) : 
+	owner(owner),
+	significant([&owner]() -> cosmos_common_significant& {
+		if (owner.is_shared()) {
+			owner.significant = std::make_shared<cosmos_common_significant>(*owner.significant);
+		}
+
+		return *owner.significant;
+	}())
+{
+	++owner.pins;
+}
+
+cosmos_common::write_handle::~write_handle() {
+	--owner.pins;
+}
+
+cosmos_common::cosmos_common(const cosmos_common& b) : 
+	significant(
+		b.pins > 0 
+		? std::make_shared<cosmos_common_significant>(*b.significant) 
+		: b.significant
+	)
+{}
+
+cosmos_common& cosmos_common::operator=(const cosmos_common& b) {
+	if (this == &b || significant == b.significant) {
+		return *this;
+	}
+
+	if (pins > 0) {
+		*significant = *b.significant;
+	}
+	else if (b.pins > 0) {
+		significant = std::make_shared<cosmos_common_significant>(*b.significant);
+	}
+	else {
+		significant = b.significant;
+	}
+
+	return *this;
+}
+
 void cosmos_common::reinfer() {
 	
 }
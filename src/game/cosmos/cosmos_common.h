@@ -1,8 +1,58 @@
 #pragma once
+#include <memory>
 #include "game/cosmos/cosmos_common_significant.h"
 
-struct cosmos_common {
-	cosmos_common_significant significant;
+/*
+	Copies of a cosmos share the common significant state until one of them changes it.
+	This way the arenas of a dedicated server that loaded the same map keep a single copy of its flavours and assets,
+	and copying a cosmos never copies the flavours.
+
+	Changes go through a write_handle.
+	While any handle is alive, the state stays unique to its cosmos:
+	copies made from it get their own copy of the state, 
+	and assigning to it overwrites the state in place.
+*/
+
+class cosmos_common {
+	std::shared_ptr<cosmos_common_significant> significant = std::make_shared<cosmos_common_significant>();
+	unsigned pins = 0;
+
+	bool is_shared() const {
+		return significant.use_count() > 1;
+	}
+
+public:
+	class write_handle {
+		cosmos_common& owner;
+		cosmos_common_significant& significant;
+
+	public:
+		write_handle(cosmos_common& owner);
+		~write_handle();
+
+		write_handle(const write_handle&) = delete;
+		write_handle& operator=(const write_handle&) = delete;
+
+		cosmos_common_significant& operator*() const {
+			return significant;
+		}
+
+		cosmos_common_significant* operator->() const {
+			return &significant;
+		}
+	};
+
+	cosmos_common() = default;
+	cosmos_common(const cosmos_common&);
+	cosmos_common& operator=(const cosmos_common&);
+
+	const cosmos_common_significant& get() const {
+		return *significant;
+	}
+
+	write_handle get_for_change() {
+		return write_handle(*this);
+	}
 
 	void reinfer();
 };
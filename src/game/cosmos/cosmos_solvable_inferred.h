@@ -9,6 +9,7 @@
 #include "game/inferred_caches/flavour_id_cache.h"
 #include "game/inferred_caches/processing_lists_cache.h"
 #include "game/inferred_caches/organism_cache.h"
+#include "game/inferred_caches/signi_digest_cache.h"
 
 #include "game/detail/inventory/inventory_slot_id.h"
 
@@ -29,5 +30,6 @@ struct cosmos_solvable_inferred {
 	processing_lists_cache processing;
 	tree_of_npo_cache tree_of_npo;
 	organism_cache organisms;
+	signi_digest_cache signi_digests;
 	// END GEN INTROSPECTOR
 };
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "game/cosmos/cosmic_functions.h"
 #include "game/detail/entity_handle_mixins/get_current_slot.hpp"
 #include "game/cosmos/entity_creation_error.h"
+#include "game/cosmos/get_corresponding.h"
 
 template <class E, class C, class I, class P>
 ref_typed_entity_handle<E> cosmic::specific_create_entity_detail(
@@ -21,10 +22,7 @@ ref_typed_entity_handle<E> cosmic::specific_create_entity_detail(
 	const auto new_allocation = cosm.get_solvable({}).template allocate_next_entity<E>({ flavour_id.raw });
 	const auto handle = ref_typed_entity_handle<E> { cosm, { new_allocation.object, new_allocation.key } };
 
-	{
-		auto& object = new_allocation.object;
-		object.component_state = initial_components;
-	}
+	cosmic::assign_components(handle, initial_components);
 
 	pre_construction(handle, handle.get({}));
 	construct_pre_inference(handle);
@@ -105,6 +103,7 @@ ref_typed_entity_handle<E> cosmic::undo_delete_entity(
 	C& cosm,
 	const I undo_delete_input,
 	const entity_solvable<E>& deleted_content,
+	const make_hot_components<E>& deleted_hot_content,
 	const reinference_type reinference
 ) {
 	auto& s = cosm.get_solvable({});
@@ -114,6 +113,8 @@ ref_typed_entity_handle<E> cosmic::undo_delete_entity(
 	
 	const auto handle = ref_typed_entity_handle<E> { cosm, { new_allocation.object, new_allocation.key } };
 
+	cosmic::assign_components(handle, deleted_hot_content);
+
 	if (reinference == reinference_type::ONLY_AFFECTED) {
 		infer_caches_for(handle);
 	}
@@ -124,6 +125,45 @@ ref_typed_entity_handle<E> cosmic::undo_delete_entity(
 	return handle;
 }
 
+template <class H, class I>
+void cosmic::assign_components(
+	const H& handle,
+	const I& components
+) {
+	using E = entity_type_of<H>;
+
+	auto& object = handle.get({});
+
+	for_each_through_std_get(
+		components,
+		[&](const auto& c) {
+			using C = remove_cref<decltype(c)>;
+
+			if constexpr(is_hot_component_v<E, C>) {
+				get_hot_component<C>(handle) = c;
+			}
+			else {
+				object.template get<C>() = c;
+			}
+		}
+	);
+}
+
+template <class H>
+auto cosmic::get_hot_components(const H& handle) {
+	make_hot_components<entity_type_of<H>> output;
+
+	for_each_through_std_get(
+		output,
+		[&](auto& c) {
+			using C = remove_cref<decltype(c)>;
+			c = get_hot_component<C>(handle);
+		}
+	);
+
+	return output;
+}
+
 template <class E>
 void cosmic::make_suitable_for_cloning(entity_solvable<E>& solvable) {
 	auto& new_components = solvable.component_state;
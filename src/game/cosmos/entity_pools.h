@@ -8,15 +8,19 @@
 
 #include "game/cosmos/pool_size_type.h"
 #include "game/cosmos/per_entity_type.h"
+#include "game/cosmos/hot_component.h"
 
 template <class E>
 struct entity_solvable;
 
+template <class T>
+using synchronized_arrays_of = concatenate_lists_t<typename T::synchronized_arrays, hot_component_arrays_of<T>>;
+
 template <class T>
 using make_entity_pool = std::conditional_t<
 	statically_allocate_entities,
-	augs::pool<entity_solvable<T>, of_size<T::statically_allocated_entities>::template make_nontrivial_constant_vector, cosmic_pool_size_type, typename T::synchronized_arrays>,
-	augs::pool<entity_solvable<T>, make_vector, cosmic_pool_size_type, typename T::synchronized_arrays>
+	augs::pool<entity_solvable<T>, of_size<T::statically_allocated_entities>::template make_nontrivial_constant_vector, cosmic_pool_size_type, synchronized_arrays_of<T>>,
+	augs::pool<entity_solvable<T>, make_vector, cosmic_pool_size_type, synchronized_arrays_of<T>>
 >;
 
 using all_entity_pools = per_entity_type_container<make_entity_pool>;
@@ -27,7 +27,8 @@ struct entity_solvable_meta {
 template <class E>
 struct entity_solvable : entity_solvable_meta {
 	using used_entity_type = E;
-	using components_type = make_components<E>;
+	/* Hot components are kept by the pool in synchronized arrays. */
+	using components_type = make_cold_components<E>;
 	using entity_solvable_meta::entity_solvable_meta;
 	using introspect_base = entity_solvable_meta;
 
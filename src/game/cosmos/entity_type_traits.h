@@ -24,6 +24,37 @@ using components_of = typename T::component_list;
 template <class T>
 using invariants_and_components_of = concatenate_lists_t<invariants_of<T>, components_of<T>>;
 
+/*
+	An entity type may list some of its components in hot_component_list.
+	These are not stored in entity_solvable, but in arrays of their own, synchronized with the entity pool,
+	so that the systems reading just them for every entity iterate over contiguous memory.
+*/
+
+template <class T, class = void>
+struct hot_components_of_detail {
+	using type = type_list<>;
+};
+
+template <class T>
+struct hot_components_of_detail<T, std::void_t<typename T::hot_component_list>> {
+	using type = typename T::hot_component_list;
+};
+
+template <class T>
+using hot_components_of = typename hot_components_of_detail<T>::type;
+
+template <class T, class C>
+constexpr bool is_hot_component_v = is_one_of_list_v<C, hot_components_of<T>>;
+
+template <class T>
+struct is_cold_component_of {
+	template <class C>
+	struct type : std::bool_constant<!is_hot_component_v<T, C>> {};
+};
+
+template <class T>
+using cold_components_of = filter_types_in_list_t<is_cold_component_of<T>::template type, components_of<T>>;
+
 template <class T>
 using make_invariants = 
 	std::conditional_t<
@@ -42,6 +73,18 @@ using make_components =
 	>
 ;
 
+template <class T>
+using make_cold_components = 
+	std::conditional_t<
+		all_in_list_are_v<std::is_trivially_copyable, cold_components_of<T>>,
+		replace_list_type_t<cold_components_of<T>, augs::trivially_copyable_tuple>,
+		replace_list_type_t<cold_components_of<T>, std::tuple>
+	>
+;
+
+template <class T>
+using make_hot_components = replace_list_type_t<hot_components_of<T>, std::tuple>;
+
 template <template <class> class Predicate>
 using entity_types_passing = filter_types_in_list_t<Predicate, all_entity_types>;
 
@@ -1,8 +1,18 @@
 #pragma once
+#include "augs/templates/maybe_const.h"
 #include "game/cosmos/specific_entity_handle_declaration.h"
+#include "game/cosmos/hot_component.h"
 
 template <class T, class H>
 auto& get_corresponding(const H& handle) {
 	using entity_type = entity_type_of<H>;
 	return handle.get_cosmos().get_solvable({}).significant.template get_pool<entity_type>().template get_corresponding<T>(handle.get_subject());
 }
+
+template <class C, class H>
+auto& get_hot_component(const H& handle) {
+	auto& element = get_corresponding<hot_component<C>>(handle);
+	using R = std::remove_reference_t<decltype(element)>;
+
+	return static_cast<maybe_const_ref_t<std::is_const_v<R>, C>>(element);
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <type_traits>
+#include "augs/templates/transform_types.h"
+#include "augs/templates/traits/component_traits.h"
+#include "game/cosmos/entity_type_traits.h"
+
+/*
+	The element of a pool's synchronized array holding a hot component.
+	Unlike the caches, it is solvable state, so the pool writes, reads and hashes it along with the entities.
+*/
+
+template <class C>
+struct hot_component : C {
+	static_assert(std::is_trivially_copyable_v<C>, "A hot component must be trivially copyable.");
+	static_assert(!is_synchronized_v<C>, "A synchronized component can't be hot, as its synchronizer expects it inside entity_solvable.");
+
+	using introspect_base = C;
+
+	static constexpr bool is_cache = false;
+	static constexpr bool is_synchronized_solvable = true;
+};
+
+template <class E>
+using hot_component_arrays_of = transform_types_in_list_t<hot_components_of<E>, hot_component>;
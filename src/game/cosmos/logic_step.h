@@ -83,6 +83,15 @@ public:
 	operator const_logic_step() const {
 		return { input, transient, step_rng, result };
 	}
+
+	/* 
+		The same step, but posting messages into separate queues.
+		Used to solve independent systems concurrently.
+	*/
+
+	basic_logic_step with_transient(data_living_one_step_ref new_transient) const {
+		return { input, new_transient, step_rng, result };
+	}
 	
 	bool any_deletion_occured() const {
 		return transient.messages.template get_queue<messages::will_soon_be_deleted>().size() > 0;
@@ -0,0 +1,22 @@
+#pragma once
+#include "game/organization/all_entity_types_declaration.h"
+
+/*
+	Entities of these types are only ever created in the editor.
+	Once a match has started, their pools stay exactly as they were in the initial solvable.
+
+	The network code relies on this to never send these pools,
+	and the client relies on it to skip them when transferring the referential solvable into the predicted one.
+*/
+
+using entity_types_never_changing_in_game = type_list<
+	static_decoration,
+	box_marker,
+	particles_decoration,
+	wandering_pixels_decoration,
+	point_marker,
+	static_light
+>;
+
+template <class E>
+constexpr bool never_changes_in_game_v = is_one_of_list_v<E, entity_types_never_changing_in_game>;
@@ -0,0 +1,114 @@
+#include "augs/misc/pool/pool_io.hpp"
+#include "augs/readwrite/byte_readwrite.h"
+#include "augs/readwrite/field_hashing_stream.h"
+#include "augs/templates/hash_templates.h"
+#include "augs/string/get_type_name.h"
+#include "augs/string/typesafe_sprintf.h"
+
+#include "game/organization/all_component_includes.h"
+#include "game/organization/for_each_entity_type.h"
+#include "game/cosmos/cosmos.h"
+#include "game/cosmos/never_changes_in_game.h"
+#include "game/cosmos/solvable_signi_digest.h"
+
+template <class T>
+static uint64_t hash_bytes_of(const T& object) {
+	augs::field_hashing_stream hs;
+	augs::write_bytes(hs, object);
+	return hs.get_hash();
+}
+
+solvable_signi_digest cosmos::calculate_solvable_signi_digest() const {
+	const auto& signi = get_solvable().significant;
+
+	solvable_signi_digest out;
+
+	out.clock = hash_bytes_of(signi.clk);
+	out.specific_names = hash_bytes_of(signi.specific_names);
+	out.global = hash_bytes_of(signi.global);
+
+	const auto& cache = get_solvable_inferred().signi_digests;
+
+	for_each_entity_type([&](auto e) {
+		using E = decltype(e);
+
+		auto calculate_pool_digest = [&]() {
+			augs::field_hashing_stream hs;
+			signi.get_pool<E>().write_contents_bytes(hs);
+
+			return hs.get_hash();
+		};
+
+		if constexpr(never_changes_in_game_v<E>) {
+			out.pools[ENTITY_TYPE_IDX<E>] = cache.get_pool_digest<E>(calculate_pool_digest);
+		}
+		else {
+			out.pools[ENTITY_TYPE_IDX<E>] = calculate_pool_digest();
+		}
+	});
+
+	return out;
+}
+
+uint64_t solvable_signi_digest::combined() const {
+	auto h = augs::hash_multiple(clock, specific_names, global);
+
+	for (const auto& p : pools) {
+		augs::hash_combine(h, p);
+	}
+
+	return h;
+}
+
+std::string solvable_signi_digest::summary() const {
+	auto result = typesafe_sprintf(
+		"clock: %x\nspecific_names: %x\nglobal: %x\n",
+		clock,
+		specific_names,
+		global
+	);
+
+	for_each_entity_type([&](auto e) {
+		using E = decltype(e);
+
+		result += typesafe_sprintf("%x: %x\n", get_type_name_strip_namespace<E>(), pools[ENTITY_TYPE_IDX<E>]);
+	});
+
+	return result;
+}
+
+std::string solvable_signi_digest::describe_differences(const solvable_signi_digest& expected) const {
+	std::string result;
+
+	auto compare = [&](const auto& name, const uint64_t actual_value, const uint64_t expected_value) {
+		if (actual_value != expected_value) {
+			result += typesafe_sprintf("%x: expected %x, actual %x\n", name, expected_value, actual_value);
+		}
+	};
+
+	compare("clock", clock, expected.clock);
+	compare("specific_names", specific_names, expected.specific_names);
+	compare("global", global, expected.global);
+
+	for_each_entity_type([&](auto e) {
+		using E = decltype(e);
+		constexpr auto idx = ENTITY_TYPE_IDX<E>;
+
+		compare(get_type_name_strip_namespace<E>(), pools[idx], expected.pools[idx]);
+	});
+
+	return result;
+}
+
+bool solvable_signi_digest::operator==(const solvable_signi_digest& b) const {
+	return 
+		clock == b.clock
+		&& specific_names == b.specific_names
+		&& global == b.global
+		&& pools == b.pools
+	;
+}
+
+bool solvable_signi_digest::operator!=(const solvable_signi_digest& b) const {
+	return !operator==(b);
+}
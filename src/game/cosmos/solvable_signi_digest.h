@@ -0,0 +1,30 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+#include "game/cosmos/per_entity_type.h"
+
+/*
+	Hashes of the complete significant state of the solvable, 
+	one per entity pool plus the remaining members.
+
+	The combined value detects a desync in any part of the state,
+	while comparing the per-pool values tells which pool diverged.
+*/
+
+struct solvable_signi_digest {
+	// GEN INTROSPECTOR struct solvable_signi_digest
+	uint64_t clock = 0;
+	uint64_t specific_names = 0;
+	uint64_t global = 0;
+
+	per_entity_type_array<uint64_t> pools = {};
+	// END GEN INTROSPECTOR
+
+	uint64_t combined() const;
+	std::string summary() const;
+	std::string describe_differences(const solvable_signi_digest& expected) const;
+
+	bool operator==(const solvable_signi_digest& b) const;
+	bool operator!=(const solvable_signi_digest& b) const;
+};
@@ -38,6 +38,8 @@
 #include "game/stateless_systems/remnant_system.h"
 
 #include "game/organization/all_messages_includes.h"
+#include <array>
+#include "augs/templates/thread_pool.h"
 
 #define STRESS_TEST_REINFERENCES 0
 
@@ -52,6 +54,49 @@ data_living_one_step& standard_solver::get_thread_local_queues() {
 	return queues;
 }
 
+/*
+	Solves systems that touch disjoint sets of components concurrently.
+
+	Every job posts into its own message queues,
+	which are then appended to the step's queues in the order of arguments,
+	so the result is identical to calling the jobs one after another.
+
+	The jobs must not use the step_rng nor write to the solve result.
+*/
+
+template <class... Jobs>
+static void solve_concurrently(const logic_step step, Jobs&&... jobs) {
+	auto* const pool = step.get_settings().logic_pool;
+
+	if (pool == nullptr || pool->size() == 0) {
+		(jobs(step), ...);
+		return;
+	}
+
+	thread_local std::array<data_living_one_step, sizeof...(Jobs)> job_queues;
+
+	std::size_t i = 0;
+
+	auto enqueue_job = [&](auto& job) {
+		auto& queues = job_queues[i++];
+
+		pool->enqueue([&queues, &job, step]() {
+			queues.clear();
+			job(step.with_transient(queues));
+		});
+	};
+
+	(enqueue_job(jobs), ...);
+
+	pool->submit();
+	pool->help_until_no_tasks();
+	pool->wait_for_all_tasks_to_complete();
+
+	for (const auto& queues : job_queues) {
+		step.transient.messages += queues.messages;
+	}
+}
+
 void standard_solve(const logic_step step) {
 	auto& cosm = step.get_cosmos();
 	auto& performance = cosm.profiler;
@@ -173,9 +218,11 @@ void standard_solve(const logic_step step) {
 
 	physics_system().post_and_clear_accumulated_collision_messages(step);
 
-	trace_system().lengthen_sprites_of_traces(step);
-
-	crosshair_system().integrate_crosshair_recoils(step);
+	solve_concurrently(
+		step,
+		[](const logic_step step) { trace_system().lengthen_sprites_of_traces(step); },
+		[](const logic_step step) { crosshair_system().integrate_crosshair_recoils(step); }
+	);
 
 	item_system().pick_up_touching_items(step);
 
@@ -222,12 +269,8 @@ void standard_solve(const logic_step step) {
 	}
 
 	{
-		auto pathfinding_raycasts_scope = cosm.measure_raycasts(performance.pathfinding_raycasts);
-
-#if TODO_PATHFINDING
 		auto scope = measure_scope(performance.pathfinding);
 		pathfinding_system().advance_pathfinding_sessions(step);
-#endif
 	}
 
 	{
@@ -235,8 +278,11 @@ void standard_solve(const logic_step step) {
 		perform_transfers(transfers, step);
 	}
 
-	trace_system().destroy_outdated_traces(step);
-	remnant_system().shrink_and_destroy_remnants(step);
+	solve_concurrently(
+		step,
+		[](const logic_step step) { trace_system().destroy_outdated_traces(step); },
+		[](const logic_step step) { remnant_system().shrink_and_destroy_remnants(step); }
+	);
 
 	const auto queued_before_marking_num = step.get_queue<messages::queue_deletion>().size();
 	(void)queued_before_marking_num;
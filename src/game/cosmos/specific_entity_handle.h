@@ -1,6 +1,7 @@
 #pragma once
 #include "augs/templates/folded_finders.h"
 #include "augs/templates/for_each_std_get.h"
+#include "augs/templates/for_each_type.h"
 
 #include "game/cosmos/component_synchronizer.h"
 #include "game/cosmos/entity_pools.h"
@@ -10,6 +11,7 @@
 #include "game/cosmos/entity_solvable.h"
 #include "game/cosmos/cosmos_solvable_access.h"
 #include "game/cosmos/entity_type_traits.h"
+#include "game/cosmos/get_corresponding.h"
 
 #include "game/detail/entity_handle_mixins/all_handle_mixins.h"
 #include "game/common_state/entity_flavours.h"
@@ -272,7 +274,12 @@ private:
 
 	template <class T>
 	maybe_const_ptr_t<is_const, T> find_component_ptr() const {
-		if constexpr(subject_type::template has<T>()) {
+		if constexpr(is_hot_component_v<entity_type, T>) {
+			ensure_alive();
+
+			return std::addressof(get_hot_component<T>(*this));
+		}
+		else if constexpr(subject_type::template has<T>()) {
 			ensure_alive();
 
 			return std::addressof(get_subject().template get<T>());
@@ -403,7 +410,14 @@ public:
 
 		for_each_through_std_get(
 			immutable_subject.component_state, 
-			std::forward<F>(callback)
+			callback
+		);
+
+		for_each_type_in_list<hot_components_of<entity_type>>(
+			[&](auto c) {
+				using C = decltype(c);
+				callback(std::as_const(get_hot_component<C>(*this)));
+			}
 		);
 	}
 
@@ -32,18 +32,17 @@ namespace behaviours {
 		auto& pathfinding = subject.get<components::pathfinding>();
 
 		if (o == tree::execution_occurence::FIRST) {
-			pathfinding.start_exploring();
-			pathfinding.custom_exploration_hint.enabled = true;
-			pathfinding.custom_exploration_hint.origin = attitude.last_seen_target_position;
-			pathfinding.custom_exploration_hint.target = attitude.last_seen_target_position + attitude.last_seen_target_velocity;
+			/* Follow where the target was heading when it was last seen. */
+			pathfinding.start_pathfinding(attitude.last_seen_target_position + attitude.last_seen_target_velocity);
 		}
 		else if (o == tree::execution_occurence::LAST) {
 			movement.reset_movement_flags();
 			pathfinding.stop_and_clear_pathfinding();
 		}
 		else {
-			if (pathfinding.has_exploring_finished()) {
-				ensure(false);
+			if (pathfinding.has_pathfinding_finished()) {
+				movement.reset_movement_flags();
+				attitude.is_alert = false;
 			}
 			else {
 				movement.set_flags_from_closest_direction(pathfinding.get_current_navigation_point() - subject.get_logic_transform().pos);
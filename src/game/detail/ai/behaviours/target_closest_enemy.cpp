@@ -13,6 +13,11 @@
 #include "game/cosmos/logic_step.h"
 #include "game/cosmos/entity_handle.h"
 #include "game/cosmos/data_living_one_step.h"
+#include "game/detail/sentience/sentience_getters.h"
+#include "game/enums/filters.h"
+
+/* How far a bot notices its enemies, provided nothing blocks the line of sight. */
+static constexpr real32 target_acquisition_radius = 1500.f;
 
 namespace behaviours {
 
@@ -28,34 +33,50 @@ namespace behaviours {
 		auto subject = cosm[t.subject];
 		const auto subject_transform = subject.get_logic_transform();
 		const auto pos = subject_transform.pos;
-		/* auto& los = t.step.transient.calculated_line_of_sight.at(subject); */
 		auto& attitude = subject.get<components::attitude>();
 
 		entity_id closest_hostile_raw;
 
-		float min_distance = std::numeric_limits<float>::max();
+		{
+			const auto& physics = cosm.get_solvable_inferred().physics;
+
+			const auto hostiles = ::get_closest_hostiles(
+				subject,
+				subject,
+				target_acquisition_radius,
+				filters[predefined_filter_type::CHARACTER]
+			);
 
-		(void)min_distance;
-		/* for (auto s_raw : los.visible_sentiences) { */
-		/* 	auto s = cosm[s_raw]; */
-		/* 	const auto calculated_attitude = calc_attitude(s, subject); */
+			/* Sorted by distance, so the first hostile in sight is the closest visible one. */
 
-		/* 	if (is_hostile(calculated_attitude)) { */
-		/* 		auto dist = (s.get_logic_transform().pos - pos).length_sq(); */
+			for (const auto& candidate : hostiles) {
+				const auto hostile = cosm[candidate];
+
+				if (sentient_and_unconscious(hostile)) {
+					continue;
+				}
 
-		/* 		if (dist < min_distance) { */
-		/* 			closest_hostile_raw = s; */
-		/* 			min_distance = dist; */
-		/* 		} */
-		/* 	} */
-		/* } */
+				const auto line_of_sight = physics.ray_cast_px(
+					cosm.get_si(),
+					pos,
+					hostile.get_logic_transform().pos,
+					predefined_queries::line_of_sight(),
+					subject
+				);
+
+				if (!line_of_sight.hit) {
+					closest_hostile_raw = candidate;
+					break;
+				}
+			}
+		}
 
 		auto closest_hostile = cosm[closest_hostile_raw];
 
 		attitude.currently_attacked_visible_entity = closest_hostile;
 
-		const auto closest_hostile_transform = closest_hostile.get_logic_transform();
-		const auto closest_hostile_velocity = closest_hostile.get_effective_velocity();
+		const auto closest_hostile_transform = closest_hostile.alive() ? closest_hostile.get_logic_transform() : transformr();
+		const auto closest_hostile_velocity = closest_hostile.alive() ? closest_hostile.get_effective_velocity() : vec2();
 
 		if (closest_hostile.alive()) {
 			attitude.is_alert = true;
@@ -1,45 +1,63 @@
 #include "game/cosmos/cosmos.h"
+#include "game/cosmos/entity_handle.h"
 #include "game/assets/behaviour_tree.h"
+#include "game/components/behaviour_tree_component.h"
 #include "game/detail/ai/behaviours.h"
+#include "game/detail/ai/create_standard_behaviour_trees.h"
 
-#if TODO
-void create_standard_behaviour_trees(cosmos& manager) {
-	auto& soldier_movement = manager[assets::behaviour_tree_id::SOLDIER_MOVEMENT];
+namespace {
+	struct standard_behaviour_trees {
+		std::array<behaviour_tree, static_cast<std::size_t>(assets::behaviour_tree_id::COUNT)> trees;
 
-	soldier_movement.root.mode = behaviour_tree::node::type::SELECTOR;
+		behaviour_tree& operator[](const assets::behaviour_tree_id id) {
+			return trees[static_cast<std::size_t>(id)];
+		}
 
-	soldier_movement.root.create_branches(
-		new behaviours::immediate_evasion,
-		new behaviours::minimize_recoil_through_movement,
-		new behaviours::navigate_to_last_seen_position_of_target,
-		new behaviours::explore_in_search_for_last_seen_target
-	);
+		/* 
+			build_tree remembers the addresses of the nodes,
+			so the trees are built in place and never moved afterwards.
+		*/
 
-	soldier_movement.build_tree();
+		standard_behaviour_trees() {
+			auto& soldier_movement = (*this)[assets::behaviour_tree_id::SOLDIER_MOVEMENT];
 
-	auto& hands_actor = manager[assets::behaviour_tree_id::HANDS_ACTOR];
+			soldier_movement.root.mode = behaviour_tree::node::type::SELECTOR;
 
-	hands_actor.root.create_branches(new behaviours::pull_trigger);
+			soldier_movement.root.create_branches(
+				new behaviours::navigate_to_last_seen_position_of_target,
+				new behaviours::explore_in_search_for_last_seen_target
+			);
 
-	hands_actor.root;
-	hands_actor.build_tree();
+			auto& hostile_target_prioritization = (*this)[assets::behaviour_tree_id::HOSTILE_TARGET_PRIORITIZATION];
 
+			hostile_target_prioritization.root.create_branches(new behaviours::target_closest_enemy);
 
-	auto& item_picker = manager[assets::behaviour_tree_id::ITEM_PICKER];
+			/* The item picker, the hands and the inventory actors are not ported yet and stay empty. */
 
+			for (auto& t : trees) {
+				t.build_tree();
+			}
+		}
+	};
+}
 
-	//item_picker.root.branch(new behaviours::usable_item_marker);
-	item_picker.build_tree();
-
-
-	auto& inventory_actor = manager[assets::behaviour_tree_id::INVENTORY_ACTOR];
-
-	inventory_actor.root;
-	inventory_actor.build_tree();
-
-	auto& hostile_target_prioritization = manager[assets::behaviour_tree_id::HOSTILE_TARGET_PRIORITIZATION];
+const behaviour_tree& get_standard_behaviour_tree(const assets::behaviour_tree_id id) {
+	static standard_behaviour_trees standard;
+	return standard[id];
+}
 
-	hostile_target_prioritization.root.create_branches(new behaviours::target_closest_enemy);
-	hostile_target_prioritization.build_tree();
+void assign_standard_behaviour_trees(const entity_handle& subject) {
+	if (const auto tree_component = subject.find<components::behaviour_tree>()) {
+		auto& trees = tree_component->concurrent_trees;
+		trees.clear();
+
+		for (const auto id : {
+			assets::behaviour_tree_id::HOSTILE_TARGET_PRIORITIZATION,
+			assets::behaviour_tree_id::SOLDIER_MOVEMENT
+		}) {
+			behaviour_tree_instance instance;
+			instance.tree_id = id;
+			trees.push_back(instance);
+		}
+	}
 }
-#endif
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+#include "game/assets/ids/behaviour_tree_id.h"
+#include "game/cosmos/entity_handle_declaration.h"
+
+class behaviour_tree;
+
+/*
+	The trees hold no state of their own - that lives in components::behaviour_tree of every subject -
+	so they are built once and shared by all cosmoi.
+*/
+
+const behaviour_tree& get_standard_behaviour_tree(assets::behaviour_tree_id);
+
+/* Lets the AI drive the character, e.g. when a bot is spawned. */
+
+void assign_standard_behaviour_trees(const entity_handle& subject);
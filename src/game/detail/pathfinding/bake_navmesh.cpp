@@ -0,0 +1,404 @@
+#include <cmath>
+
+#include "augs/log.h"
+#include "game/cosmos/cosmos.h"
+#include "game/cosmos/change_common_significant.hpp"
+#include "game/inferred_caches/physics_world_cache.h"
+#include "game/detail/physics/physics_queries.h"
+#include "game/detail/pathfinding/bake_navmesh.h"
+
+/* Past this many squares, the grid gets coarser so that a huge arena does not take forever to bake. */
+constexpr std::size_t MAX_NAVMESH_GRID_SQUARES = 4096 * 4096;
+
+static bool is_navmesh_obstacle(const b2Fixture& fixture) {
+	return fixture.GetBody()->GetType() == b2_staticBody && !fixture.IsSensor();
+}
+
+navigation_mesh make_navmesh_from_grid(
+	const vec2 origin,
+	const real32 grid_cell_size,
+	const uint32_t grid_width,
+	const uint32_t grid_height,
+	const std::vector<bool>& walkable
+) {
+	navigation_mesh mesh;
+
+	mesh.baked = true;
+	mesh.origin = origin;
+	mesh.grid_cell_size = grid_cell_size;
+	mesh.grid_width = grid_width;
+	mesh.grid_height = grid_height;
+	mesh.grid.assign(grid_width * grid_height, NAVMESH_NO_CELL);
+
+	auto is_free = [&](const uint32_t x, const uint32_t y) {
+		const auto i = y * grid_width + x;
+		return walkable[i] && mesh.grid[i] == NAVMESH_NO_CELL;
+	};
+
+	auto to_world = [&](const uint32_t x, const uint32_t y) {
+		return origin + vec2(static_cast<real32>(x), static_cast<real32>(y)) * grid_cell_size;
+	};
+
+	struct grid_rect {
+		uint32_t x0;
+		uint32_t y0;
+		uint32_t x1;
+		uint32_t y1;
+	};
+
+	std::vector<grid_rect> rects;
+
+	/* Greedily grow rectangles: first as far right as possible, then as far down as the whole row allows. */
+
+	for (uint32_t y = 0; y < grid_height; ++y) {
+		for (uint32_t x = 0; x < grid_width; ++x) {
+			if (!is_free(x, y)) {
+				continue;
+			}
+
+			auto x1 = x;
+
+			while (x1 + 1 < grid_width && is_free(x1 + 1, y)) {
+				++x1;
+			}
+
+			auto y1 = y;
+
+			while (y1 + 1 < grid_height) {
+				bool whole_row_free = true;
+
+				for (auto rx = x; rx <= x1; ++rx) {
+					if (!is_free(rx, y1 + 1)) {
+						whole_row_free = false;
+						break;
+					}
+				}
+
+				if (!whole_row_free) {
+					break;
+				}
+
+				++y1;
+			}
+
+			const auto new_cell = static_cast<navmesh_cell_index>(mesh.cells.size());
+
+			for (auto ry = y; ry <= y1; ++ry) {
+				for (auto rx = x; rx <= x1; ++rx) {
+					mesh.grid[ry * grid_width + rx] = new_cell;
+				}
+			}
+
+			const auto lt = to_world(x, y);
+			const auto rb = to_world(x1 + 1, y1 + 1);
+
+			navmesh_cell cell;
+			cell.bounds = ltrb(lt.x, lt.y, rb.x, rb.y);
+
+			mesh.cells.push_back(cell);
+			rects.push_back({ x, y, x1, y1 });
+		}
+	}
+
+	/* Portals are found by walking along each side of a cell. */
+
+	for (std::size_t c = 0; c < mesh.cells.size(); ++c) {
+		const auto& r = rects[c];
+		auto& cell = mesh.cells[c];
+
+		cell.first_portal = static_cast<uint32_t>(mesh.portals.size());
+
+		/*
+			"edge" is the grid line that the side lies on, "neighbours" the row or column right behind it.
+			In screen coordinates, walking right has the smaller y on the left hand,
+			walking down has the greater x on the left hand, and so on.
+		*/
+
+		auto add_portals_along = [&](
+			const bool vertical,
+			const uint32_t edge,
+			const int neighbours,
+			const uint32_t from,
+			const uint32_t to,
+			const bool left_is_first
+		) {
+			auto neighbour_at = [&](const uint32_t i) {
+				return vertical ? mesh.get_cell_at_grid(neighbours, i) : mesh.get_cell_at_grid(i, neighbours);
+			};
+
+			auto point_at = [&](const uint32_t i) {
+				return vertical ? to_world(edge, i) : to_world(i, edge);
+			};
+
+			auto i = from;
+
+			while (i <= to) {
+				const auto neighbour = neighbour_at(i);
+				auto run_end = i;
+
+				while (run_end + 1 <= to && neighbour_at(run_end + 1) == neighbour) {
+					++run_end;
+				}
+
+				if (neighbour != NAVMESH_NO_CELL) {
+					const auto first = point_at(i);
+					const auto last = point_at(run_end + 1);
+
+					navmesh_portal portal;
+
+					portal.to = neighbour;
+					portal.left = left_is_first ? first : last;
+					portal.right = left_is_first ? last : first;
+
+					mesh.portals.push_back(portal);
+				}
+
+				i = run_end + 1;
+			}
+		};
+
+		/* Right, left, bottom and top sides. */
+		add_portals_along(true, r.x1 + 1, static_cast<int>(r.x1) + 1, r.y0, r.y1, false);
+		add_portals_along(true, r.x0, static_cast<int>(r.x0) - 1, r.y0, r.y1, true);
+		add_portals_along(false, r.y1 + 1, static_cast<int>(r.y1) + 1, r.x0, r.x1, true);
+		add_portals_along(false, r.y0, static_cast<int>(r.y0) - 1, r.x0, r.x1, false);
+
+		cell.num_portals = static_cast<uint32_t>(mesh.portals.size()) - cell.first_portal;
+	}
+
+	return mesh;
+}
+
+navigation_mesh bake_navmesh(
+	const b2World& world,
+	const si_scaling si,
+	const pathfinding_settings& settings
+) {
+	const auto filter = predefined_queries::pathfinding();
+
+	b2AABB bounds;
+	bool any_obstacle = false;
+
+	for (auto b = world.GetBodyList(); b != nullptr; b = b->GetNext()) {
+		for (auto f = b->GetFixtureList(); f != nullptr; f = f->GetNext()) {
+			if (!is_navmesh_obstacle(*f) || !b2ContactFilter::ShouldCollide(&filter, &f->GetFilterData())) {
+				continue;
+			}
+
+			b2AABB aabb;
+			f->GetShape()->ComputeAABB(&aabb, b->GetTransform(), 0);
+
+			if (any_obstacle) {
+				bounds.Combine(aabb);
+			}
+			else {
+				bounds = aabb;
+				any_obstacle = true;
+			}
+		}
+	}
+
+	if (!any_obstacle) {
+		navigation_mesh empty;
+		empty.baked = true;
+		return empty;
+	}
+
+	const auto lower = vec2(si.get_pixels(vec2(bounds.lowerBound)));
+	const auto upper = vec2(si.get_pixels(vec2(bounds.upperBound)));
+
+	auto cell_size = std::max(settings.navmesh_cell_size, 1.f);
+
+	auto calc_squares = [&](const real32 extent) {
+		return static_cast<uint32_t>(std::ceil(extent / cell_size));
+	};
+
+	while (static_cast<std::size_t>(calc_squares(upper.x - lower.x)) * calc_squares(upper.y - lower.y) > MAX_NAVMESH_GRID_SQUARES) {
+		cell_size *= 2;
+	}
+
+	const auto origin = vec2(
+		std::floor(lower.x / cell_size) * cell_size,
+		std::floor(lower.y / cell_size) * cell_size
+	);
+
+	const auto width = calc_squares(upper.x - origin.x);
+	const auto height = calc_squares(upper.y - origin.y);
+
+	std::vector<bool> walkable(width * height, true);
+
+	const auto half_extent = si.get_meters(cell_size / 2 + settings.agent_radius);
+
+	b2Transform identity;
+	identity.SetIdentity();
+
+	for (uint32_t y = 0; y < height; ++y) {
+		for (uint32_t x = 0; x < width; ++x) {
+			const auto center = origin + (vec2(static_cast<real32>(x), static_cast<real32>(y)) + vec2(0.5f, 0.5f)) * cell_size;
+
+			b2PolygonShape square;
+			square.SetAsBox(half_extent, half_extent, b2Vec2(si.get_meters(center)), 0.f);
+
+			b2AABB square_aabb;
+			square.ComputeAABB(&square_aabb, identity, 0);
+
+			for_each_in_aabb_meters(
+				world,
+				square_aabb,
+				filter,
+				[&](const b2Fixture& fixture) {
+					if (!is_navmesh_obstacle(fixture)) {
+						return callback_result::CONTINUE;
+					}
+
+					const auto overlaps = b2TestOverlap(
+						fixture.GetShape(),
+						0,
+						&square,
+						0,
+						fixture.GetBody()->GetTransform(),
+						identity
+					);
+
+					if (overlaps) {
+						walkable[y * width + x] = false;
+						return callback_result::ABORT;
+					}
+
+					return callback_result::CONTINUE;
+				}
+			);
+		}
+	}
+
+	auto mesh = make_navmesh_from_grid(origin, cell_size, width, height, walkable);
+
+	LOG("Baked a navmesh of %x cells and %x portals on a %xx%x grid.", mesh.cells.size(), mesh.portals.size(), width, height);
+
+	return mesh;
+}
+
+navigation_mesh bake_navmesh(const cosmos& cosm) {
+	return bake_navmesh(
+		cosm.get_solvable_inferred().physics.get_b2world(),
+		cosm.get_si(),
+		cosm.get_common_significant().pathfinding
+	);
+}
+
+void rebake_navmesh(cosmos& cosm) {
+	auto baked = bake_navmesh(cosm);
+
+	cosm.change_common_significant([&](cosmos_common_significant& common) {
+		common.navmesh = std::move(baked);
+		return changer_callback_result::DONT_REFRESH;
+	});
+}
+
+void bake_navmesh_if_necessary(cosmos& cosm) {
+	if (!cosm.get_common_significant().navmesh.is_baked()) {
+		rebake_navmesh(cosm);
+	}
+}
+
+#if BUILD_UNIT_TESTS
+#include <Catch/single_include/catch2/catch.hpp>
+#include "game/enums/filters.h"
+#include "game/detail/pathfinding/navmesh_path_finder.h"
+
+TEST_CASE("BakeNavmesh") {
+	const auto si = si_scaling();
+
+	pathfinding_settings settings;
+	settings.navmesh_cell_size = 10.f;
+	settings.agent_radius = 10.f;
+
+	b2World world(b2Vec2(0.f, 0.f));
+
+	auto add_box = [&](const b2BodyType type, const ltrb px, const b2Filter filter, const bool sensor = false) {
+		b2BodyDef body_def;
+		body_def.type = type;
+
+		const auto body = world.CreateBody(&body_def);
+
+		b2PolygonShape shape;
+		shape.SetAsBox(
+			si.get_meters(px.w() / 2),
+			si.get_meters(px.h() / 2),
+			b2Vec2(si.get_meters(px.get_center())),
+			0.f
+		);
+
+		b2FixtureDef fixture_def;
+		fixture_def.shape = &shape;
+		fixture_def.filter = filter;
+		fixture_def.isSensor = sensor;
+
+		body->CreateFixture(&fixture_def);
+	};
+
+	const auto wall = filters[predefined_filter_type::WALL];
+
+	REQUIRE(!navigation_mesh().is_baked());
+
+	{
+		const auto empty = bake_navmesh(world, si, settings);
+
+		REQUIRE(empty.is_baked());
+		REQUIRE(!empty.has_cells());
+	}
+
+	/* Two posts bounding the arena and a wall between them, with a gap at the bottom. */
+
+	add_box(b2_staticBody, ltrb(0, 0, 20, 400), wall);
+	add_box(b2_staticBody, ltrb(380, 0, 400, 400), wall);
+	add_box(b2_staticBody, ltrb(190, 0, 210, 300), wall);
+
+	/* None of these block the way. */
+
+	add_box(b2_staticBody, ltrb(90, 90, 110, 110), wall, true);
+	add_box(b2_staticBody, ltrb(90, 190, 110, 210), filters[predefined_filter_type::CHARACTER]);
+	add_box(b2_dynamicBody, ltrb(290, 90, 310, 110), wall);
+
+	const auto mesh = bake_navmesh(world, si, settings);
+
+	REQUIRE(mesh.is_baked());
+	REQUIRE(mesh.has_cells());
+	REQUIRE(mesh.grid_cell_size == 10.f);
+	REQUIRE(mesh.origin.x <= 0.f);
+	REQUIRE(mesh.origin.y <= 0.f);
+	REQUIRE(mesh.origin.x + mesh.grid_width * mesh.grid_cell_size >= 400.f);
+	REQUIRE(mesh.origin.y + mesh.grid_height * mesh.grid_cell_size >= 400.f);
+
+	/* Squares closer to an obstacle than the agent radius are not walkable. */
+
+	REQUIRE(mesh.get_cell_at(vec2(200, 100)) == NAVMESH_NO_CELL);
+	REQUIRE(mesh.get_cell_at(vec2(185, 100)) == NAVMESH_NO_CELL);
+	REQUIRE(mesh.get_cell_at(vec2(25, 100)) == NAVMESH_NO_CELL);
+	REQUIRE(mesh.get_cell_at(vec2(165, 100)) != NAVMESH_NO_CELL);
+
+	REQUIRE(mesh.get_cell_at(vec2(100, 100)) != NAVMESH_NO_CELL);
+	REQUIRE(mesh.get_cell_at(vec2(100, 200)) != NAVMESH_NO_CELL);
+	REQUIRE(mesh.get_cell_at(vec2(300, 100)) != NAVMESH_NO_CELL);
+
+	for (const auto& cell : mesh.cells) {
+		REQUIRE(cell.num_portals > 0);
+	}
+
+	/* The only way to the other side leads through the gap. */
+
+	navmesh_path_finder finder;
+	std::vector<vec2> waypoints;
+
+	const auto result = finder.find_path(mesh, vec2(100, 100), vec2(300, 100), 1000, waypoints);
+
+	REQUIRE(result.found);
+	REQUIRE(result.complete);
+	REQUIRE(waypoints.size() >= 3);
+	REQUIRE(waypoints.back() == vec2(300, 100));
+
+	for (std::size_t i = 0; i + 1 < waypoints.size(); ++i) {
+		REQUIRE(waypoints[i].y >= 300.f);
+	}
+}
+#endif
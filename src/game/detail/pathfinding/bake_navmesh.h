@@ -0,0 +1,47 @@
+#pragma once
+#include <vector>
+#include "augs/math/si_scaling.h"
+#include "game/common_state/navmesh.h"
+#include "game/common_state/pathfinding_settings.h"
+
+class cosmos;
+class b2World;
+
+/*
+	Bakes the navmesh out of the static fixtures currently in the physics world,
+	as seen by predefined_queries::pathfinding.
+	An arena without any static obstacle gets an empty navmesh,
+	in which case the pathfinding goes in a straight line.
+
+	Bots walk it when their movement tree goes after the last seen position of a target.
+*/
+
+navigation_mesh bake_navmesh(const cosmos&);
+
+navigation_mesh bake_navmesh(
+	const b2World&,
+	si_scaling,
+	const pathfinding_settings&
+);
+
+/*
+	Merges the walkable squares of a grid into rectangular cells and connects them with portals.
+	walkable holds grid_width * grid_height values, row by row.
+*/
+
+navigation_mesh make_navmesh_from_grid(
+	vec2 origin,
+	real32 grid_cell_size,
+	uint32_t grid_width,
+	uint32_t grid_height,
+	const std::vector<bool>& walkable
+);
+
+/*
+	intercosm::load_from_bytes bakes the arenas saved before navmeshes existed,
+	right after they are reinferred.
+	The editor bakes anew whenever it saves, so that the navmesh stays in sync with the geometry.
+*/
+
+void rebake_navmesh(cosmos&);
+void bake_navmesh_if_necessary(cosmos&);
@@ -0,0 +1,284 @@
+#include <algorithm>
+#include "game/detail/pathfinding/navmesh_path_finder.h"
+
+/* How far, in grid squares, a point outside of the navmesh is looked around for the closest cell. */
+constexpr int NEAREST_CELL_SEARCH_DISTANCE = 8;
+
+static real32 triangle_area_doubled(const vec2 a, const vec2 b, const vec2 c) {
+	return (c - a).cross(b - a);
+}
+
+navmesh_path_result navmesh_path_finder::find_path(
+	const navigation_mesh& mesh,
+	const vec2 from,
+	const vec2 to,
+	const uint32_t max_expanded_cells,
+	std::vector<vec2>& waypoints
+) {
+	navmesh_path_result result;
+	waypoints.clear();
+
+	const auto start = mesh.find_nearest_cell(from, NEAREST_CELL_SEARCH_DISTANCE);
+
+	if (start == NAVMESH_NO_CELL) {
+		return result;
+	}
+
+	result.found = true;
+
+	const auto goal = mesh.find_nearest_cell(to, NEAREST_CELL_SEARCH_DISTANCE);
+
+	auto clamped_from = from;
+	auto clamped_to = to;
+
+	mesh.cells[start].bounds.snap_point(clamped_from);
+
+	if (goal != NAVMESH_NO_CELL) {
+		mesh.cells[goal].bounds.snap_point(clamped_to);
+	}
+
+	if (states.size() != mesh.cells.size() || current_query == static_cast<uint32_t>(-1)) {
+		states.assign(mesh.cells.size(), cell_state());
+		current_query = 0;
+	}
+
+	++current_query;
+	open.clear();
+
+	auto heuristic = [&](const vec2 p) {
+		return (clamped_to - p).length();
+	};
+
+	auto visit = [&](
+		const navmesh_cell_index cell,
+		const real32 cost,
+		const vec2 entry,
+		const navmesh_cell_index parent,
+		const uint32_t via_portal
+	) {
+		auto& s = states[cell];
+
+		s.cost = cost;
+		s.entry = entry;
+		s.parent = parent;
+		s.via_portal = via_portal;
+		s.query = current_query;
+		s.closed = false;
+
+		open.push_back({ cost + heuristic(entry), cell });
+		std::push_heap(open.begin(), open.end());
+	};
+
+	visit(start, 0.f, clamped_from, NAVMESH_NO_CELL, 0);
+
+	auto best = start;
+	auto best_distance = heuristic(clamped_from);
+	bool reached = false;
+	bool limit_hit = false;
+
+	while (!open.empty()) {
+		std::pop_heap(open.begin(), open.end());
+		const auto current = open.back().cell;
+		open.pop_back();
+
+		auto& s = states[current];
+
+		if (s.closed) {
+			continue;
+		}
+
+		s.closed = true;
+
+		if (const auto distance = heuristic(s.entry); distance < best_distance) {
+			best = current;
+			best_distance = distance;
+		}
+
+		if (current == goal) {
+			best = goal;
+			reached = true;
+			break;
+		}
+
+		if (result.expanded_cells >= max_expanded_cells) {
+			limit_hit = true;
+			break;
+		}
+
+		++result.expanded_cells;
+
+		const auto& cell = mesh.cells[current];
+		const auto current_cost = s.cost;
+		const auto current_entry = s.entry;
+
+		for (auto p = cell.first_portal; p < cell.first_portal + cell.num_portals; ++p) {
+			const auto& portal = mesh.portals[p];
+			const auto& neighbour = states[portal.to];
+
+			const auto entry = portal.get_center();
+			const auto cost = current_cost + (entry - current_entry).length();
+
+			if (neighbour.query == current_query && (neighbour.closed || neighbour.cost <= cost)) {
+				continue;
+			}
+
+			visit(portal.to, cost, entry, current, p);
+		}
+	}
+
+	/*
+		If the whole reachable area was searched without finding the goal,
+		the closest reachable point is as good as it gets, so the path is complete.
+	*/
+
+	result.complete = !limit_hit;
+
+	corridor.clear();
+
+	for (auto c = best; states[c].parent != NAVMESH_NO_CELL; c = states[c].parent) {
+		corridor.push_back(states[c].via_portal);
+	}
+
+	std::reverse(corridor.begin(), corridor.end());
+
+	auto destination = clamped_to;
+
+	if (!reached) {
+		destination = to;
+		mesh.cells[best].bounds.snap_point(destination);
+	}
+
+	pull_string(mesh, clamped_from, destination, waypoints);
+
+	return result;
+}
+
+/*
+	The "simple stupid funnel algorithm":
+	the funnel is narrowed portal by portal,
+	and whenever one of its sides would cross the other, the crossed corner becomes a waypoint.
+*/
+
+void navmesh_path_finder::pull_string(
+	const navigation_mesh& mesh,
+	const vec2 from,
+	const vec2 to,
+	std::vector<vec2>& waypoints
+) const {
+	const auto num_portals = corridor.size() + 2;
+
+	auto get_portal = [&](const std::size_t i) {
+		if (i == 0) {
+			return std::make_pair(from, from);
+		}
+
+		if (i == num_portals - 1) {
+			return std::make_pair(to, to);
+		}
+
+		const auto& portal = mesh.portals[corridor[i - 1]];
+		return std::make_pair(portal.left, portal.right);
+	};
+
+	auto apex = from;
+	auto left = from;
+	auto right = from;
+
+	std::size_t apex_index = 0;
+	std::size_t left_index = 0;
+	std::size_t right_index = 0;
+
+	for (std::size_t i = 1; i < num_portals; ++i) {
+		const auto [portal_left, portal_right] = get_portal(i);
+
+		if (triangle_area_doubled(apex, right, portal_right) <= 0.f) {
+			if (apex == right || triangle_area_doubled(apex, left, portal_right) > 0.f) {
+				right = portal_right;
+				right_index = i;
+			}
+			else {
+				waypoints.push_back(left);
+
+				apex = left;
+				apex_index = left_index;
+
+				right = apex;
+				right_index = apex_index;
+
+				i = apex_index;
+				continue;
+			}
+		}
+
+		if (triangle_area_doubled(apex, left, portal_left) >= 0.f) {
+			if (apex == left || triangle_area_doubled(apex, right, portal_left) < 0.f) {
+				left = portal_left;
+				left_index = i;
+			}
+			else {
+				waypoints.push_back(right);
+
+				apex = right;
+				apex_index = right_index;
+
+				left = apex;
+				left_index = apex_index;
+
+				i = apex_index;
+				continue;
+			}
+		}
+	}
+
+	if (waypoints.empty() || !(waypoints.back() == to)) {
+		waypoints.push_back(to);
+	}
+}
+
+#if BUILD_UNIT_TESTS
+#include <Catch/single_include/catch2/catch.hpp>
+#include "game/detail/pathfinding/bake_navmesh.h"
+
+TEST_CASE("NavmeshPathFinder") {
+	/* A 10x10 grid of 10 px squares, split by a wall with a gap at the bottom. */
+
+	const uint32_t size = 10;
+	std::vector<bool> walkable(size * size, true);
+
+	for (uint32_t y = 0; y < 8; ++y) {
+		walkable[y * size + 5] = false;
+	}
+
+	const auto mesh = make_navmesh_from_grid(vec2::zero, 10.f, size, size, walkable);
+
+	REQUIRE(mesh.cells.size() == 3);
+	REQUIRE(mesh.get_cell_at(vec2(55, 15)) == NAVMESH_NO_CELL);
+
+	navmesh_path_finder finder;
+	std::vector<vec2> waypoints;
+
+	{
+		const auto result = finder.find_path(mesh, vec2(15, 15), vec2(85, 15), 100, waypoints);
+
+		REQUIRE(result.found);
+		REQUIRE(result.complete);
+		REQUIRE(waypoints == std::vector<vec2> { vec2(50, 80), vec2(60, 80), vec2(85, 15) });
+	}
+
+	{
+		const auto result = finder.find_path(mesh, vec2(15, 15), vec2(25, 35), 100, waypoints);
+
+		REQUIRE(result.complete);
+		REQUIRE(result.expanded_cells == 0);
+		REQUIRE(waypoints == std::vector<vec2> { vec2(25, 35) });
+	}
+
+	{
+		const auto result = finder.find_path(mesh, vec2(15, 15), vec2(85, 15), 1, waypoints);
+
+		REQUIRE(result.found);
+		REQUIRE(!result.complete);
+		REQUIRE(waypoints.size() > 0);
+	}
+}
+#endif
@@ -0,0 +1,76 @@
+#pragma once
+#include <vector>
+#include "game/common_state/navmesh.h"
+
+struct navmesh_path_result {
+	uint32_t expanded_cells = 0;
+
+	/* False only if the start could not be resolved to any cell. */
+	bool found = false;
+
+	/*
+		False if the expansion limit was hit before reaching the target.
+		The path then leads to the cell closest to the target that was seen so far,
+		and should be queried again once it is walked.
+	*/
+
+	bool complete = false;
+};
+
+/*
+	A* over the cells of a navmesh,
+	followed by pulling a string through the portals of the chosen corridor.
+
+	The buffers are kept between queries,
+	so that a single finder can serve any number of them without allocating.
+*/
+
+class navmesh_path_finder {
+	struct cell_state {
+		real32 cost = 0.f;
+		vec2 entry;
+		navmesh_cell_index parent = NAVMESH_NO_CELL;
+		uint32_t via_portal = 0;
+		uint32_t query = 0;
+		bool closed = false;
+	};
+
+	struct open_cell {
+		real32 estimate = 0.f;
+		navmesh_cell_index cell = NAVMESH_NO_CELL;
+
+		bool operator<(const open_cell& b) const {
+			if (estimate == b.estimate) {
+				return cell > b.cell;
+			}
+
+			return estimate > b.estimate;
+		}
+	};
+
+	std::vector<cell_state> states;
+	std::vector<open_cell> open;
+	std::vector<uint32_t> corridor;
+	uint32_t current_query = 0;
+
+	void pull_string(
+		const navigation_mesh& mesh,
+		vec2 from,
+		vec2 to,
+		std::vector<vec2>& waypoints
+	) const;
+
+public:
+	navmesh_path_result find_path(
+		const navigation_mesh& mesh,
+		vec2 from,
+		vec2 to,
+		uint32_t max_expanded_cells,
+		std::vector<vec2>& waypoints
+	);
+};
+
+inline auto& thread_local_navmesh_path_finder() {
+	thread_local navmesh_path_finder finder;
+	return finder;
+}
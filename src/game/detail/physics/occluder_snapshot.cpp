@@ -0,0 +1,148 @@
+#include <Box2D/Dynamics/b2World.h>
+#include <Box2D/Dynamics/b2Fixture.h>
+
+#include "game/detail/physics/occluder_snapshot.h"
+
+void occluder_snapshot::clear() {
+	occluders.clear();
+	polygons.clear();
+	circles.clear();
+	tree.reset();
+}
+
+void occluder_snapshot::rebuild(const physics_world_cache& physics, const b2AABB region_meters) {
+	clear();
+
+	const auto& world = physics.get_b2world();
+	const auto& broadphase = world.GetContactManager().m_broadPhase;
+
+	struct gather_input : b2QueryCallback {
+		occluder_snapshot& self;
+		const b2BroadPhase& broadphase;
+
+		gather_input(
+			occluder_snapshot& self,
+			const b2BroadPhase& broadphase
+		) :
+			self(self),
+			broadphase(broadphase)
+		{}
+
+		bool ReportFixture(b2Fixture* const fixture) override {
+			const auto type = fixture->GetType();
+
+			if (type != b2Shape::e_polygon && type != b2Shape::e_circle) {
+				return true;
+			}
+
+			auto& o = self.occluders.emplace_back();
+
+			o.transform = fixture->GetBody()->GetTransform();
+			o.filter = fixture->GetFilterData();
+			o.fat_aabb = broadphase.GetFatAABB(fixture->m_proxies[0].proxyId);
+			o.owner = fixture->GetBody()->GetUserData();
+			o.type = type;
+
+			if (type == b2Shape::e_polygon) {
+				o.shape_index = static_cast<uint32_t>(self.polygons.size());
+				self.polygons.push_back(*static_cast<const b2PolygonShape*>(fixture->GetShape()));
+			}
+			else {
+				o.shape_index = static_cast<uint32_t>(self.circles.size());
+				self.circles.push_back(*static_cast<const b2CircleShape*>(fixture->GetShape()));
+			}
+
+			return true;
+		}
+	};
+
+	auto in = gather_input(*this, broadphase);
+	world.QueryAABB(&in, region_meters);
+
+	tree.emplace();
+
+	for (std::size_t i = 0; i < occluders.size(); ++i) {
+		tree->CreateProxy(occluders[i].fat_aabb, reinterpret_cast<void*>(i));
+	}
+}
+
+physics_raycast_output occluder_snapshot::ray_cast(
+	const vec2 p1_meters,
+	const vec2 p2_meters,
+	const b2Filter filter,
+	const entity_id ignore_entity,
+	std::vector<physics_raycast_output>* const all_outputs
+) const {
+	struct raycast_input {
+		const occluder_snapshot& self;
+		const b2Filter filter;
+		const entity_id ignore_entity;
+		std::vector<physics_raycast_output>* const all_outputs;
+
+		physics_raycast_output output;
+
+		float32 RayCastCallback(const b2RayCastInput& input, const int32 proxy_id) {
+			const auto& o = self.get_occluder(proxy_id);
+
+			if (is_ignored(o, filter, ignore_entity)) {
+				return input.maxFraction;
+			}
+
+			b2RayCastOutput shape_output;
+
+			if (!self.get_shape(o).RayCast(&shape_output, input, o.transform, 0)) {
+				return input.maxFraction;
+			}
+
+			/* Same as in b2WorldRayCastWrapper, so that the points are bit-identical. */
+			const auto fraction = shape_output.fraction;
+			const auto point = (1.0f - fraction) * input.p1 + fraction * input.p2;
+
+			output.intersection = point;
+			output.hit = true;
+			output.what_entity = o.owner;
+			output.normal = shape_output.normal;
+
+			if (all_outputs) {
+				all_outputs->push_back(output);
+				return 1.f;
+			}
+
+			return fraction;
+		}
+	};
+
+	auto callback = raycast_input { *this, filter, ignore_entity, all_outputs, {} };
+
+	if (!tree || !((p1_meters - p2_meters).length_sq() > 0.f)) {
+		return callback.output;
+	}
+
+	b2RayCastInput input;
+	input.maxFraction = 1.0f;
+	input.p1 = b2Vec2(p1_meters);
+	input.p2 = b2Vec2(p2_meters);
+
+	tree->RayCast(&callback, input);
+	return callback.output;
+}
+
+physics_raycast_output occluder_snapshot::ray_cast(
+	const vec2 p1_meters,
+	const vec2 p2_meters,
+	const b2Filter filter,
+	const entity_id ignore_entity
+) const {
+	return ray_cast(p1_meters, p2_meters, filter, ignore_entity, nullptr);
+}
+
+std::vector<physics_raycast_output> occluder_snapshot::ray_cast_all_intersections(
+	const vec2 p1_meters,
+	const vec2 p2_meters,
+	const b2Filter filter,
+	const entity_id ignore_entity
+) const {
+	std::vector<physics_raycast_output> outputs;
+	ray_cast(p1_meters, p2_meters, filter, ignore_entity, &outputs);
+	return outputs;
+}
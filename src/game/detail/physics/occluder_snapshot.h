@@ -0,0 +1,122 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <optional>
+
+#include <Box2D/Collision/b2DynamicTree.h>
+#include <Box2D/Collision/Shapes/b2PolygonShape.h>
+#include <Box2D/Collision/Shapes/b2CircleShape.h>
+#include <Box2D/Dynamics/b2WorldCallbacks.h>
+#include <Box2D/Dynamics/b2Body.h>
+
+#include "game/inferred_caches/physics_world_cache.h"
+
+/*
+	A copy of the shapes found in some region of the physics world,
+	taken by a visibility job so that it can be queried
+	without walking the b2World for every ray.
+
+	The queries mirror those of physics_world_cache and give the same results:
+	the shapes, their transforms, filters and fat AABBs are copied as they are,
+	and the exact tests are the ones of Box2D itself.
+*/
+
+class occluder_snapshot {
+	struct occluder {
+		b2Transform transform;
+		b2Filter filter;
+		b2AABB fat_aabb;
+		Userdata owner;
+
+		b2Shape::Type type = b2Shape::e_polygon;
+		uint32_t shape_index = 0;
+	};
+
+	std::vector<occluder> occluders;
+	std::vector<b2PolygonShape> polygons;
+	std::vector<b2CircleShape> circles;
+
+	const b2Shape& get_shape(const occluder& o) const {
+		if (o.type == b2Shape::e_circle) {
+			return circles[o.shape_index];
+		}
+
+		return polygons[o.shape_index];
+	}
+
+	std::optional<b2DynamicTree> tree;
+
+	static bool is_ignored(const occluder& o, const b2Filter filter, const entity_id ignored_entity) {
+		return
+			o.owner == Userdata(ignored_entity)
+			|| !b2ContactFilter::ShouldCollide(&filter, &o.filter)
+		;
+	}
+
+	const occluder& get_occluder(const int32 proxy_id) const {
+		return occluders[reinterpret_cast<std::uintptr_t>(tree->GetUserData(proxy_id))];
+	}
+
+	physics_raycast_output ray_cast(
+		const vec2 p1_meters,
+		const vec2 p2_meters,
+		const b2Filter filter,
+		const entity_id ignore_entity,
+		std::vector<physics_raycast_output>* all_outputs
+	) const;
+
+public:
+	void rebuild(const physics_world_cache&, b2AABB region_meters);
+	void clear();
+
+	std::size_t size() const {
+		return occluders.size();
+	}
+
+	template <class F>
+	void for_each_polygon_in_aabb_meters(
+		const b2AABB aabb,
+		const b2Filter filter,
+		const entity_id ignored_entity,
+		F callback
+	) const {
+		if (!tree) {
+			return;
+		}
+
+		struct query_input {
+			const occluder_snapshot& self;
+			const b2AABB aabb;
+			const b2Filter filter;
+			const entity_id ignored_entity;
+			F& call;
+
+			bool QueryCallback(const int32 proxy_id) {
+				const auto& o = self.get_occluder(proxy_id);
+
+				if (o.type == b2Shape::e_polygon && b2TestOverlap(o.fat_aabb, aabb) && !is_ignored(o, filter, ignored_entity)) {
+					call(self.polygons[o.shape_index], o.transform);
+				}
+
+				return true;
+			}
+		};
+
+		auto in = query_input { *this, aabb, filter, ignored_entity, callback };
+		tree->Query(&in, aabb);
+	}
+
+	physics_raycast_output ray_cast(
+		const vec2 p1_meters,
+		const vec2 p2_meters,
+		const b2Filter filter,
+		const entity_id ignore_entity = entity_id()
+	) const;
+
+	std::vector<physics_raycast_output> ray_cast_all_intersections(
+		const vec2 p1_meters,
+		const vec2 p2_meters,
+		const b2Filter filter,
+		const entity_id ignore_entity = entity_id()
+	) const;
+};
@@ -0,0 +1,80 @@
+#include <unordered_map>
+
+#include "augs/templates/algorithm_templates.h"
+#include "game/detail/static_render_chunks.h"
+
+#include "game/cosmos/cosmos.h"
+#include "game/cosmos/entity_handle.h"
+#include "game/cosmos/for_each_entity.h"
+
+#include "game/inferred_caches/tree_of_npo_cache.hpp"
+#include "game/detail/calc_render_layer.h"
+#include "game/detail/calc_sorting_order.h"
+
+template <class E>
+struct is_static_decoration : std::is_same<E, static_decoration> {};
+
+void static_render_chunks::clear() {
+	chunks.clear();
+	built = false;
+}
+
+void static_render_chunks::refresh(const cosmos& cosm) {
+	const auto revision = cosm.get_solvable_inferred().tree_of_npo.get_static_decorations_revision();
+
+	if (built && built_revision == revision) {
+		return;
+	}
+
+	rebuild(cosm);
+
+	built = true;
+	built_revision = revision;
+}
+
+void static_render_chunks::rebuild(const cosmos& cosm) {
+	chunks.clear();
+
+	std::unordered_map<vec2i, std::size_t> chunk_of_cell;
+
+	cosm.for_each_entity<is_static_decoration>([&](const auto& typed_handle) {
+		const auto cache = find_tree_of_npo_cache(typed_handle);
+
+		if (cache == nullptr || !cache->is_constructed()) {
+			return;
+		}
+
+		const auto aabb = cache->recorded_aabb;
+		const auto center = aabb.get_center();
+
+		const auto cell = vec2i(
+			static_cast<int>(std::floor(center.x / chunk_size_v)),
+			static_cast<int>(std::floor(center.y / chunk_size_v))
+		);
+
+		const auto it = chunk_of_cell.try_emplace(cell, chunks.size()).first;
+
+		if (it->second == chunks.size()) {
+			chunks.emplace_back();
+		}
+
+		auto& c = chunks[it->second];
+		c.bounds.contain(aabb);
+
+		entry e;
+		e.aabb = aabb;
+		e.order = ::calc_sorting_order(typed_handle);
+		e.id = typed_handle.get_id();
+		e.functions = typed_handle.template get<invariants::render>().special_functions;
+
+		c.per_layer[::calc_render_layer(typed_handle)].emplace_back(e);
+	});
+
+	for (auto& c : chunks) {
+		for (auto& layer : c.per_layer) {
+			sort_range(layer, [](const entry& a, const entry& b) {
+				return std::make_pair(a.order, a.id) < std::make_pair(b.order, b.id);
+			});
+		}
+	}
+}
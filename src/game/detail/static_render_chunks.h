@@ -0,0 +1,59 @@
+#pragma once
+#include <vector>
+
+#include "augs/math/rects.h"
+#include "augs/misc/enum/enum_array.h"
+#include "augs/misc/enum/enum_boolset.h"
+
+#include "game/enums/render_layer.h"
+#include "game/cosmos/entity_id.h"
+#include "game/components/sorting_order_type.h"
+#include "game/detail/special_render_function.h"
+
+class cosmos;
+
+/*
+	Static decorations (walls, floors, props) only change when they are reinferred,
+	so instead of querying the tree of npo, calculating their render layers and sorting orders
+	and sorting them again every frame, we group them once into spatial chunks
+	whose per-layer lists are already sorted.
+
+	The chunks are rebuilt only when the static decorations revision of the viewed cosmos changes.
+*/
+
+class static_render_chunks {
+public:
+	static constexpr real32 chunk_size_v = 1024.f;
+
+	struct entry {
+		ltrb aabb;
+		sorting_order_type order = 0;
+		entity_id id;
+		augs::enum_boolset<special_render_function> functions;
+	};
+
+	struct chunk {
+		ltrb bounds;
+		augs::enum_array<std::vector<entry>, render_layer> per_layer;
+	};
+
+private:
+	std::vector<chunk> chunks;
+	std::size_t built_revision = 0;
+	bool built = false;
+
+	void rebuild(const cosmos&);
+
+public:
+	void refresh(const cosmos&);
+	void clear();
+
+	template <class F>
+	void for_each_chunk_in(const ltrb camera_aabb, F&& callback) const {
+		for (const auto& c : chunks) {
+			if (c.bounds.hover(camera_aabb)) {
+				callback(c);
+			}
+		}
+	}
+};
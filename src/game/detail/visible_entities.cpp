@@ -3,6 +3,7 @@
 #include "augs/templates/container_templates.h"
 #include "game/detail/physics/physics_queries.h"
 #include "game/detail/visible_entities.h"
+#include "game/detail/static_render_chunks.h"
 
 #include "game/cosmos/cosmos.h"
 #include "game/cosmos/entity_handle.h"
@@ -11,7 +12,7 @@
 #include "game/enums/filters.h"
 #include "game/detail/physics/physics_scripts.h"
 
-#include "game/inferred_caches/tree_of_npo_cache.h"
+#include "game/inferred_caches/tree_of_npo_cache.hpp"
 #include "game/inferred_caches/physics_world_cache.h"
 #include "game/inferred_caches/organism_cache_query.hpp"
 #include "game/inferred_caches/organism_cache.hpp"
@@ -29,10 +30,67 @@ std::size_t visible_entities::count_all() const {
 
 void visible_entities::layer_register::clear() {
 	with_orders.clear();
+	sorted_runs.clear();
+}
+
+void visible_entities::layer_register::mark_sorted_run(const std::size_t since) {
+	if (since != with_orders.size()) {
+		sorted_runs.emplace_back(since, with_orders.size());
+	}
 }
 
 void visible_entities::layer_register::sort() {
-	sort_range(with_orders);
+	if (sorted_runs.empty()) {
+		sort_range(with_orders);
+		return;
+	}
+
+	/* 
+		Entries registered outside of the presorted runs get sorted in place,
+		then all runs are merged pairwise which is cheaper than sorting everything again.
+		Since (order, id) pairs are unique, the result is identical to a full sort.
+	*/
+
+	const auto at = [this](const std::size_t i) {
+		return with_orders.begin() + i;
+	};
+
+	auto& bounds = run_bounds;
+	bounds.clear();
+	bounds.push_back(0);
+
+	auto add_run_until = [&](const std::size_t end) {
+		if (end != bounds.back()) {
+			bounds.push_back(end);
+		}
+	};
+
+	for (const auto& run : sorted_runs) {
+		std::sort(at(bounds.back()), at(run.first));
+		add_run_until(run.first);
+		add_run_until(run.second);
+	}
+
+	std::sort(at(bounds.back()), with_orders.end());
+	add_run_until(with_orders.size());
+
+	while (bounds.size() > 2) {
+		std::size_t kept = 1;
+
+		for (std::size_t i = 0; i + 1 < bounds.size(); i += 2) {
+			const auto last = std::min(i + 2, bounds.size() - 1);
+
+			if (last == i + 2) {
+				std::inplace_merge(at(bounds[i]), at(bounds[i + 1]), at(bounds[i + 2]));
+			}
+
+			bounds[kept++] = bounds[last];
+		}
+
+		bounds.resize(kept);
+	}
+
+	sorted_runs.clear();
 }
 
 void visible_entities::clear() {
@@ -47,6 +105,7 @@ void visible_entities::clear() {
 
 visible_entities& visible_entities::reacquire_all(const visible_entities_query input) {
 	clear();
+	acquire_static_chunks(input);
 	acquire_non_physical(input);
 	acquire_physical(input);
 
@@ -154,10 +213,57 @@ void visible_entities::acquire_physical(const visible_entities_query input) {
 	}
 }
 
+static bool uses_static_chunks(const visible_entities_query& input) {
+	return input.static_chunks != nullptr && input.accuracy != EXACT;
+}
+
+void visible_entities::acquire_static_chunks(const visible_entities_query input) {
+	if (!::uses_static_chunks(input)) {
+		return;
+	}
+
+	auto& chunks = *input.static_chunks;
+	chunks.refresh(input.cosm);
+
+	const auto camera_aabb = input.cone.get_visible_world_rect_aabb();
+
+	chunks.for_each_chunk_in(camera_aabb, [&](const static_render_chunks::chunk& c) {
+		augs::for_each_enum_except_bounds([&](const render_layer layer) {
+			if (input.filter.is_enabled && !input.filter.value.layers[layer]) {
+				return;
+			}
+
+			if (!input.types.types[::render_layer_to_tonpo_type(layer)]) {
+				return;
+			}
+
+			auto& target = per_layer[layer];
+			const auto run_start = target.size();
+
+			for (const auto& e : c.per_layer[layer]) {
+				if (!camera_aabb.hover(e.aabb)) {
+					continue;
+				}
+
+				target.register_visible(e.id, e.order);
+
+				for (int i = 0; i < static_cast<int>(e.functions.size()); ++i) {
+					if (e.functions[i]) {
+						per_function[i].emplace_back(e.id);
+					}
+				}
+			}
+
+			target.mark_sorted_run(run_start);
+		});
+	});
+}
+
 void visible_entities::acquire_non_physical(const visible_entities_query input) {
 	const auto& cosm = input.cosm;
 	const auto camera = input.cone;
 	const auto camera_aabb = camera.get_visible_world_rect_aabb();
+	const bool skip_static_decorations = ::uses_static_chunks(input);
 
 	const auto& tree_of_npo = cosm.get_solvable_inferred().tree_of_npo;
 	const auto& organisms = cosm.get_solvable_inferred().organisms;
@@ -224,6 +330,11 @@ void visible_entities::acquire_non_physical(const visible_entities_query input)
 		else {
 			tree_of_npo.for_each_in_camera(
 				[&](const auto& unversioned_id) {
+					if (skip_static_decorations && unversioned_id.type_id == entity_type_id::of<static_decoration>()) {
+						/* Already acquired from the static chunks */
+						return;
+					}
+
 					const auto id = cosm.get_versioned(unversioned_id);
 					add_visible(id);
 				},
@@ -290,4 +401,59 @@ void visible_entities::sort_car_interiors(const cosmos& cosm) {
 #else
 	(void)cosm;
 #endif
-}
\ No newline at end of file
+}
+#if BUILD_UNIT_TESTS
+#include <random>
+#include <Catch/single_include/catch2/catch.hpp>
+
+TEST_CASE("VisibleEntities SortedRunsMergeLikeFullSort") {
+	auto rng = std::minstd_rand(1337);
+
+	auto make_id = [](const unsigned i) {
+		entity_id id;
+		id.raw.indirection_index = i;
+		id.raw.version = 1;
+		return id;
+	};
+
+	for (int trial = 0; trial < 2000; ++trial) {
+		visible_entities::layer_register reg;
+		unsigned next_index = 0;
+
+		const auto num_segments = rng() % 8;
+
+		for (unsigned s = 0; s < num_segments; ++s) {
+			const bool presorted = rng() % 2 == 0;
+			const auto num_entries = rng() % 6;
+
+			std::vector<std::pair<sorting_order_type, entity_id>> segment;
+
+			for (unsigned i = 0; i < num_entries; ++i) {
+				segment.emplace_back(static_cast<sorting_order_type>(rng() % 4), make_id(next_index++));
+			}
+
+			if (presorted) {
+				sort_range(segment);
+			}
+
+			const auto run_start = reg.size();
+
+			for (const auto& e : segment) {
+				reg.register_visible(e.second, e.first);
+			}
+
+			if (presorted) {
+				reg.mark_sorted_run(run_start);
+			}
+		}
+
+		auto expected = reg.with_orders;
+		sort_range(expected);
+
+		reg.sort();
+
+		REQUIRE(expected == reg.with_orders);
+		REQUIRE(reg.sorted_runs.empty());
+	}
+}
+#endif
@@ -15,12 +15,15 @@
 #include "augs/enums/accuracy_type.h"
 #include "game/detail/special_render_function.h"
 
+class static_render_chunks;
+
 struct visible_entities_query {
 	const cosmos& cosm;
 	const camera_cone cone;
 	const accuracy_type accuracy;
 	const augs::maybe<render_layer_filter> filter;
 	const tree_of_npo_filter types;
+	static_render_chunks* const static_chunks = nullptr;
 
 	static auto dont_filter() {
 		return augs::maybe<render_layer_filter>();
@@ -34,10 +37,14 @@ using per_render_layer_t = augs::enum_array<T, render_layer>;
 class visible_entities {
 	using id_type = entity_id;
 
+public:
 	struct layer_register {
 		using ordered_entities_type = std::vector<std::pair<sorting_order_type, id_type>>;
 		ordered_entities_type with_orders;
 
+		std::vector<std::pair<std::size_t, std::size_t>> sorted_runs;
+		std::vector<std::size_t> run_bounds;
+
 		template <class F>
 		void for_each(F&& callback) const;
 
@@ -45,6 +52,7 @@ class visible_entities {
 		void for_each_reverse(F&& callback) const;
 
 		void register_visible(const entity_id id, const sorting_order_type order);
+		void mark_sorted_run(const std::size_t since);
 
 		void clear();
 		std::size_t size() const;
@@ -52,6 +60,7 @@ class visible_entities {
 		void sort();
 	};
 
+private:
 	using per_layer_type = per_render_layer_t<layer_register>;
 	per_layer_type per_layer;
 
@@ -59,6 +68,7 @@ class visible_entities {
 	per_function_type per_function;
 
 	void register_visible(const cosmos&, entity_id);
+	void acquire_static_chunks(const visible_entities_query);
 	void sort_car_interiors(const cosmos&);
 
 public:
@@ -205,17 +205,138 @@ physics_world_cache& physics_world_cache::operator=(const physics_world_cache&)
 	return *this;
 }
 
-void physics_world_cache::clone_from(const physics_world_cache& source_cache, cosmos& target_cosm, const cosmos& source_cosm) {
-	ensure(std::addressof(target_cosm) != std::addressof(source_cosm));
-	ensure(this != std::addressof(source_cache));
+/*
+	If every object of the world lives in the chunks of its block allocator,
+	the chunks can be copied as a whole, and every pointer only needs to be moved
+	by the offset between the source chunk and the copied one.
 
-	accumulated_messages = source_cache.accumulated_messages;
+	Objects larger than b2_maxBlockSize (e.g. proxies of a fixture with many children) bypass the chunks,
+	so worlds holding any of them are still cloned object by object.
+
+	Chain shapes allocate their vertices outside of the allocator altogether,
+	but the game never creates them.
+*/
+
+void physics_world_cache::relocate_b2World_pointers(b2World& w) {
+	const b2BlockAllocator& chunks = w.m_blockAllocator;
+
+	auto relocate = [&chunks](auto*& p) {
+		p = chunks.Relocate(p);
+	};
+
+	auto relocate_contact_edge = [&relocate](b2ContactEdge& e) {
+		relocate(e.other);
+		relocate(e.contact);
+		relocate(e.prev);
+		relocate(e.next);
+	};
+
+	auto relocate_joint_edge = [&relocate](b2JointEdge& e) {
+		relocate(e.other);
+		relocate(e.joint);
+		relocate(e.prev);
+		relocate(e.next);
+	};
+
+	relocate(w.m_contactManager.m_contactList);
+
+	for (b2Contact* c = w.m_contactManager.m_contactList; c; c = c->m_next) {
+		relocate(c->m_prev);
+		relocate(c->m_next);
+		relocate(c->m_fixtureA);
+		relocate(c->m_fixtureB);
+
+		relocate_contact_edge(c->m_nodeA);
+		relocate_contact_edge(c->m_nodeB);
+	}
+
+	relocate(w.m_jointList);
+
+	for (b2Joint* j = w.m_jointList; j; j = j->m_next) {
+		relocate(j->m_prev);
+		relocate(j->m_next);
+		relocate(j->m_bodyA);
+		relocate(j->m_bodyB);
+
+		relocate_joint_edge(j->m_edgeA);
+		relocate_joint_edge(j->m_edgeB);
+	}
+
+	auto& proxy_tree = w.m_contactManager.m_broadPhase.m_tree;
+
+	relocate(w.m_bodyList);
+
+	for (b2Body* b = w.m_bodyList; b; b = b->m_next) {
+		relocate(b->m_prev);
+		relocate(b->m_next);
+		relocate(b->m_fixtureList);
+		relocate(b->m_ownerFrictionGround);
+		relocate(b->m_contactList);
+		relocate(b->m_jointList);
+
+		b->m_world = &w;
+
+		for (b2Fixture* f = b->m_fixtureList; f; f = f->m_next) {
+			relocate(f->m_next);
+			relocate(f->m_body);
+			relocate(f->m_shape);
+			relocate(f->m_proxies);
+
+			ensure(f->m_shape->GetType() != b2Shape::e_chain);
+
+			for (std::size_t i = 0; i < static_cast<std::size_t>(f->m_proxyCount); ++i) {
+				f->m_proxies[i].fixture = f;
+				relocate(proxy_tree.m_nodes[f->m_proxies[i].proxyId].userData);
+			}
+		}
+	}
+}
+
+template <class F>
+void physics_world_cache::clone_b2World(b2World& migrated_b2World, const b2World& source_b2World, F&& migrate_external_pointers) {
+	/*
+		If neither world holds blocks larger than b2_maxBlockSize,
+		b2BlockAllocator::CloneFrom overwrites the chunks the old world already owns,
+		so the old world needs no teardown at all - the field-wise copy below replaces everything else.
+	*/
+
+	const bool chunks_can_be_cloned = 
+		source_b2World.m_blockAllocator.GetLargeAllocationCount() == 0
+		&& migrated_b2World.m_blockAllocator.GetLargeAllocationCount() == 0
+	;
+
+	if (!chunks_can_be_cloned) {
+		if (migrated_b2World.m_blockAllocator.GetLargeAllocationCount() > 0) {
+			/* 
+				Large blocks live outside of the chunks, 
+				so let ~b2World return them while destroying the fixtures.
+			*/
 
-	b2World& migrated_b2World = *b2world.get();
-	migrated_b2World.~b2World();
-	new (&migrated_b2World) b2World(b2Vec2(0.f, 0.f));
+			migrated_b2World.~b2World();
+			new (&migrated_b2World) b2World(b2Vec2(0.f, 0.f));
+		}
+
+		/*
+			Don't return the chunks of the old world to the system.
+			The clone will be written into memory that is already mapped and likely still in cache,
+			which matters a lot since we clone on every reprediction.
+
+			There is no need to free the fixtures one by one -
+			TakeChunksFrom relinks every block of every chunk into the free lists anyway.
+			Only the body list is cleared so that ~b2World does not walk the stale fixtures.
+		*/
+
+		migrated_b2World.m_bodyList = nullptr;
+
+		b2BlockAllocator recycled_blocks;
+		recycled_blocks.TakeChunksFrom(migrated_b2World.m_blockAllocator);
+
+		migrated_b2World.~b2World();
+		new (&migrated_b2World) b2World(b2Vec2(0.f, 0.f));
+
+		migrated_b2World.m_blockAllocator.TakeChunksFrom(recycled_blocks);
+	}
 
-	const b2World& source_b2World = *source_cache.b2world.get();
 
 #if DEBUG_PHYSICS_SYSTEM_COPY
 	ensure_eq(0, source_b2World.m_stackAllocator.m_entryCount);
@@ -255,10 +376,37 @@ void physics_world_cache::clone_from(const physics_world_cache& source_cache, co
 	migrated_b2World.m_contactManager.m_contactFilter = &migrated_b2World.defaultFilter;
 	migrated_b2World.m_contactManager.m_contactListener = &migrated_b2World.defaultListener;
 
+	if (chunks_can_be_cloned) {
+		auto& chunks = migrated_b2World.m_blockAllocator;
+
+		chunks.CloneFrom(source_b2World.m_blockAllocator);
+		relocate_b2World_pointers(migrated_b2World);
+
+		migrate_external_pointers([&chunks](const void* const p) {
+			return const_cast<void*>(chunks.Relocate(p));
+		});
+
+		return;
+	}
+
 	std::unordered_map<const void*, void*> pointer_migrations;
 	std::unordered_map<const void*, bool> contact_edge_a_or_b_in_contacts;
 	std::unordered_map<const void*, bool> joint_edge_a_or_b_in_joints;
 
+	{
+		/* Size the maps up-front so that they never rehash during migration. */
+
+		const auto num_bodies = static_cast<std::size_t>(source_b2World.m_bodyCount);
+		const auto num_joints = static_cast<std::size_t>(source_b2World.m_jointCount);
+		const auto num_contacts = static_cast<std::size_t>(source_b2World.m_contactManager.m_contactCount);
+		const auto num_proxies = static_cast<std::size_t>(source_b2World.m_contactManager.m_broadPhase.GetProxyCount());
+
+		/* Every fixture has at least one proxy, and each fixture migrates itself and its proxy array. */
+		pointer_migrations.reserve(num_bodies + num_joints + num_contacts + num_proxies * 2);
+		contact_edge_a_or_b_in_contacts.reserve(num_contacts * 2);
+		joint_edge_a_or_b_in_joints.reserve(num_joints * 2);
+	}
+
 	b2BlockAllocator& migrated_allocator = migrated_b2World.m_blockAllocator;
 
 	const auto contact_edge_a_offset = augs_offsetof(b2Contact, m_nodeA);
@@ -526,67 +674,238 @@ void physics_world_cache::clone_from(const physics_world_cache& source_cache, co
 		inside the loop that migrated all bodies and fixtures.
 	*/
 
-	target_cosm.for_each_having<invariants::fixtures>(
-		[&](const auto& typed_collider) {
-			const auto id = typed_collider.get_id();
+	migrate_external_pointers([&pointer_migrations](const void* const p) {
+		return pointer_migrations.at(p);
+	});
 
-			auto& migrated_rigid_cache = get_corresponding<rigid_body_cache>(typed_collider);
 
-			auto& migrated_colliders_cache = get_corresponding<colliders_cache>(typed_collider);
-			migrated_colliders_cache.constructed_fixtures.clear();
+#if DEBUG_PHYSICS_SYSTEM_COPY
+	// ensure that all allocations have been migrated
 
-			source_cosm[id].template dispatch_on_having_all<invariants::fixtures>(
-				[&](const auto& source_entity) {
-					{
-						auto& migrated_cache = migrated_colliders_cache;
-						const auto& source_cache = get_corresponding<colliders_cache>(source_entity);
+	ensure_eq(
+		migrated_allocator.m_numAllocatedObjects, 
+		source_b2World.m_blockAllocator.m_numAllocatedObjects
+	);
+#endif
+}
 
-						for (const auto& f : source_cache.constructed_fixtures) {
-							migrated_cache.constructed_fixtures.emplace_back(
-								reinterpret_cast<b2Fixture*>(pointer_migrations.at(reinterpret_cast<const void*>(f.get())))
-							);
-						}
-					}
+void physics_world_cache::clone_from(const physics_world_cache& source_cache, cosmos& target_cosm, const cosmos& source_cosm) {
+	ensure(std::addressof(target_cosm) != std::addressof(source_cosm));
+	ensure(this != std::addressof(source_cache));
+
+	accumulated_messages = source_cache.accumulated_messages;
 
-					{
-						auto& migrated_cache = migrated_rigid_cache;
+	/* The inferred caches of entities point to bodies and fixtures too. */
 
-						const auto& source_cache = get_corresponding<rigid_body_cache>(source_entity);
-						const auto b_body = source_cache.body.get();
+	clone_b2World(*b2world.get(), *source_cache.b2world.get(), [&](auto migrated_address_of) {
+		target_cosm.for_each_having<invariants::fixtures>(
+			[&](const auto& typed_collider) {
+				const auto id = typed_collider.get_id();
 
-						static_assert(sizeof(migrated_cache) == sizeof(augs::propagate_const<b2Body*>));
+				auto& migrated_rigid_cache = get_corresponding<rigid_body_cache>(typed_collider);
 
-						if (b_body) {
-							migrated_cache.body = reinterpret_cast<b2Body*>(pointer_migrations.at(reinterpret_cast<const void*>(b_body)));
+				auto& migrated_colliders_cache = get_corresponding<colliders_cache>(typed_collider);
+				migrated_colliders_cache.constructed_fixtures.clear();
+
+				source_cosm[id].template dispatch_on_having_all<invariants::fixtures>(
+					[&](const auto& source_entity) {
+						{
+							auto& migrated_cache = migrated_colliders_cache;
+							const auto& source_cache = get_corresponding<colliders_cache>(source_entity);
+
+							for (const auto& f : source_cache.constructed_fixtures) {
+								migrated_cache.constructed_fixtures.emplace_back(
+									reinterpret_cast<b2Fixture*>(migrated_address_of(reinterpret_cast<const void*>(f.get())))
+								);
+							}
 						}
-						else {
-							migrated_cache.body = nullptr;
+
+						{
+							auto& migrated_cache = migrated_rigid_cache;
+
+							const auto& source_cache = get_corresponding<rigid_body_cache>(source_entity);
+							const auto b_body = source_cache.body.get();
+
+							static_assert(sizeof(migrated_cache) == sizeof(augs::propagate_const<b2Body*>));
+
+							if (b_body) {
+								migrated_cache.body = reinterpret_cast<b2Body*>(migrated_address_of(reinterpret_cast<const void*>(b_body)));
+							}
+							else {
+								migrated_cache.body = nullptr;
+							}
 						}
 					}
-				}
-			);
-		}
-	);
+				);
+			}
+		);
 
 #if TODO_JOINTS
-	joint_caches.clear();
-	joint_caches.reserve(source_cache.joint_caches.size());
+		joint_caches.clear();
+		joint_caches.reserve(source_cache.joint_caches.size());
 
-	for (auto& it : joint_caches) {
-		const auto b_joint = source_cache.joint_caches[it.first].joint.get();
+		for (auto& it : joint_caches) {
+			const auto b_joint = source_cache.joint_caches[it.first].joint.get();
 
-		if (b_joint) {
-			joint_caches[i].joint = reinterpret_cast<b2Joint*>(pointer_migrations.at(reinterpret_cast<const void*>(b_joint)));
+			if (b_joint) {
+				joint_caches[i].joint = reinterpret_cast<b2Joint*>(migrated_address_of(reinterpret_cast<const void*>(b_joint)));
+			}
 		}
-	}
 #endif
+	});
+}
+#if BUILD_UNIT_TESTS
+#include <Catch/single_include/catch2/catch.hpp>
 
-#if DEBUG_PHYSICS_SYSTEM_COPY
-	// ensure that all allocations have been migrated
+/* b2BodyDef leaves the sweep to the caller, who normally copies it from the rigid body. */
 
-	ensure_eq(
-		migrated_allocator.m_numAllocatedObjects, 
-		source_b2World.m_blockAllocator.m_numAllocatedObjects
-	);
-#endif
+static b2BodyDef clone_test_body_def(const b2BodyType type, const b2Vec2 position) {
+	b2BodyDef def;
+	def.type = type;
+	def.transform.p = position;
+
+	def.sweep.localCenter.SetZero();
+	def.sweep.c0 = position;
+	def.sweep.c = position;
+	def.sweep.a0 = 0.f;
+	def.sweep.a = 0.f;
+	def.sweep.alpha0 = 0.f;
+
+	return def;
+}
+
+static void populate_clone_test_world(b2World& w, const int num_dynamic_bodies) {
+	const auto ground_def = clone_test_body_def(b2_staticBody, b2Vec2(0.f, 0.f));
+	b2Body* const ground = w.CreateBody(&ground_def);
+
+	b2PolygonShape wall;
+	wall.SetAsBox(50.f, 1.f);
+	ground->CreateFixture(&wall, 0.f);
+
+	wall.SetAsBox(1.f, 50.f, b2Vec2(-20.f, 0.f), 0.f);
+	ground->CreateFixture(&wall, 0.f);
+
+	wall.SetAsBox(1.f, 50.f, b2Vec2(20.f, 0.f), 0.f);
+	ground->CreateFixture(&wall, 0.f);
+
+	for (int i = 0; i < num_dynamic_bodies; ++i) {
+		auto def = clone_test_body_def(b2_dynamicBody, b2Vec2((i % 30) * 1.1f - 16.f, 2.f + (i / 30) * 1.1f));
+		def.linearVelocity.Set(static_cast<float>(i % 7 - 3), static_cast<float>(-(i % 5)));
+
+		b2Body* const b = w.CreateBody(&def);
+
+		if (i % 3 == 0) {
+			b2CircleShape circle;
+			circle.m_radius = 0.5f;
+			b->CreateFixture(&circle, 1.f);
+		}
+		else {
+			b2PolygonShape box;
+			box.SetAsBox(0.5f, 0.5f);
+			b->CreateFixture(&box, 1.f);
+		}
+
+		if (i % 10 == 0) {
+			b2RevoluteJointDef revolute;
+			revolute.Initialize(ground, b, b->GetPosition() + b2Vec2(0.f, 0.5f));
+			w.CreateJoint(&revolute);
+		}
+		else if (i % 10 == 5) {
+			b2DistanceJointDef distance;
+			distance.Initialize(ground, b, b2Vec2(b->GetPosition().x, 0.f), b->GetPosition());
+			w.CreateJoint(&distance);
+		}
+	}
 }
+
+static void step_clone_test_world(b2World& w, const int steps) {
+	for (int i = 0; i < steps; ++i) {
+		w.Step(1 / 60.f, 8, 3);
+	}
+}
+
+static bool bitwise_same_bodies(const b2World& a, const b2World& b) {
+	auto same_bytes = [](const auto& x, const auto& y) {
+		return std::memcmp(&x, &y, sizeof(x)) == 0;
+	};
+
+	const b2Body* x = a.GetBodyList();
+	const b2Body* y = b.GetBodyList();
+
+	for (; x && y; x = x->GetNext(), y = y->GetNext()) {
+		if (
+			!same_bytes(x->m_xf, y->m_xf)
+			|| !same_bytes(x->m_sweep, y->m_sweep)
+			|| !same_bytes(x->m_linearVelocity, y->m_linearVelocity)
+			|| !same_bytes(x->m_angularVelocity, y->m_angularVelocity)
+			|| x->IsAwake() != y->IsAwake()
+		) {
+			return false;
+		}
+	}
+
+	return x == nullptr && y == nullptr;
+}
+
+static void clone_test_world(b2World& into, const b2World& from) {
+	physics_world_cache::clone_b2World(into, from, [](auto) {});
+
+	REQUIRE(into.GetBodyCount() == from.GetBodyCount());
+	REQUIRE(into.GetJointCount() == from.GetJointCount());
+	REQUIRE(into.GetContactCount() == from.GetContactCount());
+	REQUIRE(bitwise_same_bodies(into, from));
+}
+
+TEST_CASE("PhysicsWorldCache CloneStepsIdentically") {
+	auto source = std::make_unique<b2World>(b2Vec2(0.f, -10.f));
+	auto clone = std::make_unique<b2World>(b2Vec2(0.f, 0.f));
+
+	/* The target is not empty, so the clone has to reuse the memory of another world. */
+	populate_clone_test_world(*clone, 100);
+	step_clone_test_world(*clone, 30);
+
+	populate_clone_test_world(*source, 300);
+	step_clone_test_world(*source, 60);
+
+	REQUIRE(source->GetContactCount() > 0);
+
+	clone_test_world(*clone, *source);
+
+	step_clone_test_world(*source, 30);
+	clone_test_world(*clone, *source);
+
+	step_clone_test_world(*source, 120);
+	step_clone_test_world(*clone, 120);
+
+	REQUIRE(bitwise_same_bodies(*clone, *source));
+
+	/* The free lists of the clone must be intact. */
+	for (int i = 0; i < 50; ++i) {
+		clone->DestroyBody(clone->GetBodyList());
+	}
+
+	populate_clone_test_world(*clone, 50);
+	step_clone_test_world(*clone, 30);
+}
+
+TEST_CASE("PhysicsWorldCache CloneWithLargeAllocations") {
+	auto source = std::make_unique<b2World>(b2Vec2(0.f, -10.f));
+	auto clone = std::make_unique<b2World>(b2Vec2(0.f, 0.f));
+
+	populate_clone_test_world(*source, 300);
+	step_clone_test_world(*source, 60);
+
+	/* Chunks can't be copied as a whole once the world holds a block too large for them. */
+	void* const large_block = source->m_blockAllocator.Allocate(b2_maxBlockSize + 1);
+	REQUIRE(source->m_blockAllocator.GetLargeAllocationCount() == 1);
+
+	clone_test_world(*clone, *source);
+
+	source->m_blockAllocator.Free(large_block, b2_maxBlockSize + 1);
+
+	step_clone_test_world(*source, 120);
+	step_clone_test_world(*clone, 120);
+
+	REQUIRE(bitwise_same_bodies(*clone, *source));
+}
+#endif
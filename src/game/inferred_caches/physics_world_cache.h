@@ -54,6 +54,8 @@ class physics_world_cache {
 		const colliders_connection&
 	);
 
+	static void relocate_b2World_pointers(b2World&);
+
 public:
 	template <class E>
 	struct concerned_with {
@@ -76,6 +78,15 @@ public:
 
 	void clone_from(const physics_world_cache& source_world, cosmos& target_cosmos, const cosmos& source_cosmos);
 
+	/*
+		Clones the bodies, fixtures, joints and contacts of one world into another, reusing the memory of the target.
+		migrate_external_pointers is then called with a function that maps an address in the source world
+		to the address of its clone, so that whatever else points into the world can be migrated too.
+	*/
+
+	template <class F>
+	static void clone_b2World(b2World& migrated_b2World, const b2World& source_b2World, F&& migrate_external_pointers);
+
 	std::vector<physics_raycast_output> ray_cast_all_intersections(
 		const vec2 p1_meters,
 		const vec2 p2_meters, 
@@ -0,0 +1,12 @@
+#include "game/cosmos/entity_handle.h"
+#include "game/inferred_caches/signi_digest_cache.h"
+
+void signi_digest_cache::infer_all(const cosmos&) {
+	for (auto& d : pool_digests) {
+		d = std::nullopt;
+	}
+}
+
+void signi_digest_cache::destroy_cache_of(const const_entity_handle& h) {
+	pool_digests[h.get_id().type_id.get_index()] = std::nullopt;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+
+#include "game/cosmos/per_entity_type.h"
+#include "game/cosmos/entity_handle_declaration.h"
+#include "game/cosmos/specific_entity_handle_declaration.h"
+#include "game/cosmos/never_changes_in_game.h"
+
+class cosmos;
+
+/*
+	Digests of the entity pools that never change in game.
+
+	These pools hold most of the entities of a large map, 
+	so hashing them made up most of the cost of calculate_solvable_signi_digest.
+	Their contents change only when entities of their types are created, deleted or reinferred,
+	and each of these forgets the digest of the pool in question.
+*/
+
+class signi_digest_cache {
+	/* Filled lazily by calculate_solvable_signi_digest, which is const. */
+	mutable per_entity_type_array<std::optional<uint64_t>> pool_digests = {};
+
+public:
+	template <class E>
+	struct concerned_with {
+		static constexpr bool value = never_changes_in_game_v<E>;
+	};
+
+	template <class E, class F>
+	uint64_t get_pool_digest(F&& calculate_digest) const {
+		static_assert(concerned_with<E>::value, "Only the pools that never change in game can be cached.");
+
+		auto& cached = pool_digests[ENTITY_TYPE_IDX<E>];
+
+		if (cached == std::nullopt) {
+			cached = calculate_digest();
+		}
+
+		return *cached;
+	}
+
+	template <class E>
+	void specific_infer_cache_for(const E&) {
+		pool_digests[ENTITY_TYPE_IDX<entity_type_of<E>>] = std::nullopt;
+	}
+
+	void infer_all(const cosmos&);
+	void destroy_cache_of(const const_entity_handle&);
+};
@@ -1,3 +1,5 @@
+#include <atomic>
+
 #include "game/cosmos/logic_step.h"
 #include "game/cosmos/cosmos.h"
 #include "game/cosmos/entity_handle.h"
@@ -8,6 +10,11 @@
 
 using npo_entities = entity_types_passing<tree_of_npo_cache::concerned_with>;
 
+std::size_t tree_of_npo_cache::make_revision() {
+	static std::atomic<std::size_t> last_revision = 0;
+	return ++last_revision;
+}
+
 tree_of_npo_cache::tree& tree_of_npo_cache::get_tree(const cache& c) {
 	return trees[static_cast<std::size_t>(c.type)];
 }
@@ -24,10 +31,14 @@ void tree_of_npo_cache::destroy_cache_of(const entity_handle& e) {
 		if (const auto cache = find_tree_of_npo_cache(handle)) {
 			cache->clear(*this);
 		}
+
+		mark_changed_if_static(handle);
 	});
 }
 
 void tree_of_npo_cache::infer_all(cosmos& cosm) {
+	static_decorations_revision = make_revision();
+
 	cosm.for_each_entity<concerned_with>([this](const auto& handle) {
 		specific_infer_cache_for(handle);
 	});
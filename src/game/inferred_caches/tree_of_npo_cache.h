@@ -52,6 +52,19 @@ class tree_of_npo_cache {
 
 	tree& get_tree(const cache&);
 
+	/*
+		Bumped whenever a static decoration is inferred or destroyed.
+		Revisions are unique across all cosmoi so that the view can tell
+		when its static render chunks go stale, even after switching cosmoi.
+	*/
+
+	std::size_t static_decorations_revision = make_revision();
+
+	static std::size_t make_revision();
+
+	template <class E>
+	void mark_changed_if_static(const E&);
+
 public:
 	template <class E>
 	struct concerned_with {
@@ -101,4 +114,8 @@ public:
 
 	void infer_cache_for(const entity_handle&);
 	void destroy_cache_of(const entity_handle&);
+
+	auto get_static_decorations_revision() const {
+		return static_decorations_revision;
+	}
 };
\ No newline at end of file
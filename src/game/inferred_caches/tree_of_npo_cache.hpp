@@ -49,8 +49,17 @@ std::optional<tree_of_npo_node_input> create_default_for(const E& handle) {
 	return std::nullopt;
 }
 
+template <class E>
+void tree_of_npo_cache::mark_changed_if_static(const E&) {
+	if constexpr(std::is_same_v<entity_type_of<E>, static_decoration>) {
+		static_decorations_revision = make_revision();
+	}
+}
+
 template <class E>
 void tree_of_npo_cache::specific_infer_cache_for(const E& handle) {
+	mark_changed_if_static(handle);
+
 	const auto id = handle.get_id().to_unversioned();
 
 	auto& cache = get_corresponding<tree_of_npo_cache_data>(handle);
@@ -3,6 +3,7 @@
 #include "game/cosmos/solvers/standard_solver.h"
 #include "game/messages/health_event.h"
 #include "game/modes/bomb_defusal.hpp"
+#include "game/modes/round_template.h"
 #include "game/modes/mode_entropy.h"
 #include "game/modes/mode_helpers.h"
 #include "game/cosmos/cosmos.h"
@@ -31,6 +32,7 @@
 #include "game/messages/game_notification.h"
 #include "game/messages/hud_message.h"
 #include "game/detail/sentience/sentience_logic.h"
+#include "game/detail/ai/create_standard_behaviour_trees.h"
 
 #define LOG_BOMB_DEFUSAL 0
 
@@ -834,6 +836,10 @@ entity_id bomb_defusal::create_character_for_player(
 
 			p.controlled_character_id = handle;
 
+			if (p.is_bot) {
+				::assign_standard_behaviour_trees(handle);
+			}
+
 			if (state == arena_mode_state::LIVE) {
 				if (get_freeze_seconds_left(in) > 0.f) {
 					handle.set_frozen(true);
@@ -916,7 +922,12 @@ void bomb_defusal::setup_round(
 
 	round_speeds = in.rules.speeds;
 
-	cosm.set(in.initial_signi);
+	if (in.round_start_template != nullptr) {
+		in.round_start_template->restore(cosm, in.initial_signi);
+	}
+	else {
+		cosm.set(in.initial_signi);
+	}
 
 	/* 
 		If there are any entries in message queues, 
@@ -229,6 +229,7 @@ enum class round_start_type {
 };
 
 struct editor_property_accessors;
+class round_template;
 
 class bomb_defusal {
 public:
@@ -242,9 +243,12 @@ public:
 		const cosmos_solvable_significant& initial_signi;
 		maybe_const_ref_t<C, cosmos> cosm;
 
+		/* If null, every round start reinfers the cosmos from the initial_signi. */
+		maybe_const_ptr_t<C, round_template> round_start_template = nullptr;
+
 		template <bool is_const = C, class = std::enable_if_t<!is_const>>
 		operator basic_input<!is_const>() const {
-			return { rules, initial_signi, cosm };
+			return { rules, initial_signi, cosm, round_start_template };
 		}
 	};
 
@@ -0,0 +1,20 @@
+#include "game/modes/round_template.h"
+#include "game/cosmos/cosmos.h"
+
+round_template::round_template() = default;
+round_template::~round_template() = default;
+
+void round_template::invalidate() {
+	inferred.reset();
+}
+
+void round_template::restore(cosmos& target, const cosmos_solvable_significant& initial_signi) {
+	if (inferred == nullptr) {
+		/* Copying the target is only the easiest way to get the same common state. */
+		inferred = std::make_unique<cosmos>(target);
+		inferred->set(initial_signi);
+	}
+
+	auto scope = measure_scope(target.profiler.duplication);
+	target.assign_solvable(*inferred);
+}
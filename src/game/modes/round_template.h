@@ -0,0 +1,32 @@
+#pragma once
+#include <memory>
+
+class cosmos;
+struct cosmos_solvable_significant;
+
+/*
+	A cosmos already inferred from the initial significant state of an arena.
+
+	Restoring it at the start of a round only copies the solvable
+	and clones the physics world, the same way as a reprediction does,
+	instead of rebuilding the physics world and every other inferred cache from scratch.
+
+	Whoever owns the initial significant state also owns the template,
+	and must invalidate it whenever that state or the common significant state changes.
+*/
+
+class round_template {
+	std::unique_ptr<cosmos> inferred;
+
+public:
+	round_template();
+	~round_template();
+
+	round_template(const round_template&) = delete;
+	round_template& operator=(const round_template&) = delete;
+
+	void invalidate();
+
+	/* Has the same effect on the target as target.set(initial_signi). */
+	void restore(cosmos& target, const cosmos_solvable_significant& initial_signi);
+};
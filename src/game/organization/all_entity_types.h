@@ -44,9 +44,17 @@ struct controlled_character {
 
 		components::driver,
 		components::attitude,
+		components::pathfinding,
+		components::behaviour_tree,
 		components::head
 	>;
 
+	/* Read for every character in each step. */
+	using hot_component_list = type_list<
+		components::movement,
+		components::crosshair
+	>;
+
 	using synchronized_arrays = type_list<
 		components::interpolation,
 		items_of_slots_cache,
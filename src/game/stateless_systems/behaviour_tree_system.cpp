@@ -3,6 +3,7 @@
 #include "game/cosmos/cosmos.h"
 #include "game/cosmos/entity_id.h"
 #include "game/components/behaviour_tree_component.h"
+#include "game/detail/ai/create_standard_behaviour_trees.h"
 
 #include "game/cosmos/entity_handle.h"
 #include "game/cosmos/logic_step.h"
@@ -10,8 +11,7 @@
 
 using namespace augs;
 
-void behaviour_tree_system::evaluate_trees(const logic_step) {
-#if TODO
+void behaviour_tree_system::evaluate_trees(const logic_step step) {
 	auto& cosm = step.get_cosmos();
 
 	cosm.for_each_having<components::behaviour_tree>( 
@@ -19,11 +19,13 @@ void behaviour_tree_system::evaluate_trees(const logic_step) {
 			auto& behaviour_tree = it.template get<components::behaviour_tree>();
 			
 			for (auto& concurrent_tree : behaviour_tree.concurrent_trees) {
-				// TODO: fix behaviour tree storage
-				auto& tree = cosm[concurrent_tree.tree_id];
+				if (concurrent_tree.tree_id == assets::behaviour_tree_id::INVALID) {
+					continue;
+				}
+
+				const auto& tree = ::get_standard_behaviour_tree(concurrent_tree.tree_id);
 				tree.evaluate_instance_of_tree(step, it, concurrent_tree.state);
 			}
 		}
 	);
-#endif
 }
\ No newline at end of file
@@ -1,8 +1,47 @@
 #pragma once
+#include <vector>
+#include "augs/math/vec2.h"
+#include "game/common_state/navmesh.h"
+#include "game/common_state/pathfinding_settings.h"
+
 class cosmos;
+class navmesh_path_finder;
 #include "game/cosmos/step_declaration.h"
 
+namespace components {
+	struct pathfinding;
+}
+
+/*
+	Advances the pathfinding sessions of a single step, one subject after another,
+	sharing the step's budget of expanded cells between them.
+*/
+
+class pathfinding_sessions_step {
+	const navigation_mesh& mesh;
+	const pathfinding_settings& settings;
+	navmesh_path_finder& finder;
+
+	uint32_t query_limit = 0;
+	uint32_t remaining_budget = 0;
+	std::size_t total_expanded_cells = 0;
+	std::vector<vec2> found_waypoints;
+
+public:
+	pathfinding_sessions_step(
+		const navigation_mesh&,
+		const pathfinding_settings&,
+		navmesh_path_finder&
+	);
+
+	void advance(components::pathfinding&, vec2 subject_pos);
+
+	auto get_total_expanded_cells() const {
+		return total_expanded_cells;
+	}
+};
+
 class pathfinding_system {
 public:
 	void advance_pathfinding_sessions(const logic_step);
-};
\ No newline at end of file
+};
@@ -7,9 +7,37 @@
 #include "game/cosmos/for_each_entity.h"
 
 #include "game/stateless_systems/physics_system.h"
+#include "augs/templates/thread_pool.h"
 
 #define OVER_BODIES 0
 
+/*
+	Lets Box2D solve the independent islands on the logic pool.
+	The merge happens in b2World::Solve in a fixed order,
+	so the result is bit-identical to solving them on a single thread.
+*/
+
+class logic_pool_executor : public b2JobExecutor {
+	augs::thread_pool& pool;
+
+public:
+	logic_pool_executor(augs::thread_pool& pool) : pool(pool) {}
+
+	int32 GetConcurrency() const override {
+		return static_cast<int32>(pool.size() + 1);
+	}
+
+	void ParallelFor(const int32 count, void (*job)(void*, int32), void* const context) override {
+		for (int32 i = 0; i < count; ++i) {
+			pool.enqueue([job, context, i]() { job(context, i); });
+		}
+
+		pool.submit();
+		pool.help_until_no_tasks();
+		pool.wait_for_all_tasks_to_complete();
+	}
+};
+
 void physics_system::post_and_clear_accumulated_collision_messages(const logic_step step) {
 	auto& cosm = step.get_cosmos();
 	auto& physics = cosm.get_solvable_inferred({}).physics;
@@ -32,10 +60,18 @@ void physics_system::step_and_set_new_transforms(const logic_step step) {
 		const int32 velocityIterations = 8;
 		const int32 positionIterations = 3;
 
+		auto* const pool = step.get_settings().logic_pool;
+		std::optional<logic_pool_executor> executor;
+
+		if (pool != nullptr && pool->size() > 0) {
+			executor.emplace(*pool);
+		}
+
 		physics.b2world->Step(
 			static_cast<float32>(delta.in_seconds()),
 			velocityIterations,
-			positionIterations
+			positionIterations,
+			executor ? std::addressof(*executor) : nullptr
 		);
 
 		post_and_clear_accumulated_collision_messages(step);
@@ -57,11 +93,213 @@ void physics_system::step_and_set_new_transforms(const logic_step step) {
 			const auto rigid_body = handle.template get<components::rigid_body>();
 
 			auto& body = *rigid_body.find_cache()->body.get();
+
+			/*
+				The state of a sleeping body only changes through the synchronizer, 
+				which writes the component as well, or through the friction handler.
+
+				So once its final state has been read back after it went to sleep,
+				it can be skipped until it wakes up or lands on a friction ground.
+			*/
+
+			const bool moving = body.GetType() != b2_staticBody && body.IsAwake();
+			const bool fricted = body.m_ownerFrictionGround != nullptr;
+
+			if (!moving && !fricted && (body.m_flags & b2Body::e_readBackFlag)) {
+				return;
+			}
+
 			rigid_body.update_after_step(body);
 
 			physics.recurential_friction_handler(step, &body, body.m_ownerFrictionGround);
+
+			if (moving || fricted) {
+				body.m_flags &= ~b2Body::e_readBackFlag;
+			}
+			else {
+				body.m_flags |= b2Body::e_readBackFlag;
+			}
 		}
 	);
 #endif
 }
 
+#if BUILD_UNIT_TESTS
+#include <unordered_map>
+#include <Catch/single_include/catch2/catch.hpp>
+
+struct post_solve_record {
+	int body_a = -1;
+	int body_b = -1;
+	b2ContactImpulse impulse;
+};
+
+class post_solve_recorder : public b2ContactListener {
+	const std::unordered_map<const b2Body*, int>& body_indices;
+
+public:
+	std::vector<post_solve_record> records;
+
+	post_solve_recorder(const std::unordered_map<const b2Body*, int>& body_indices) : body_indices(body_indices) {}
+
+	void PostSolve(b2Contact* const contact, const b2ContactImpulse* const impulse) override {
+		post_solve_record r;
+		r.body_a = body_indices.at(contact->GetFixtureA()->GetBody());
+		r.body_b = body_indices.at(contact->GetFixtureB()->GetBody());
+		r.impulse = *impulse;
+
+		records.push_back(r);
+	}
+};
+
+class counting_executor : public logic_pool_executor {
+public:
+	using logic_pool_executor::logic_pool_executor;
+
+	int32 max_jobs = 0;
+
+	void ParallelFor(const int32 count, void (*job)(void*, int32), void* const context) override {
+		max_jobs = std::max(max_jobs, count);
+		logic_pool_executor::ParallelFor(count, job, context);
+	}
+};
+
+/* The constructor of b2BodyDef does not initialize the sweep. */
+
+static b2BodyDef island_test_body_def(const b2BodyType type, const b2Vec2 position) {
+	b2BodyDef def;
+	def.type = type;
+	def.transform.p = position;
+
+	def.sweep.localCenter.SetZero();
+	def.sweep.c0 = position;
+	def.sweep.c = position;
+	def.sweep.a0 = 0.f;
+	def.sweep.a = 0.f;
+	def.sweep.alpha0 = 0.f;
+
+	return def;
+}
+
+/*
+	Boxes thrown between static walls, and pendulums hanging from static anchors.
+	All of them hit the static ground, so it belongs to many islands at once.
+	The islands ignore gravity in this game, hence the initial velocities.
+*/
+
+static auto make_island_test_world(std::unordered_map<const b2Body*, int>& body_indices) {
+	auto w = std::make_unique<b2World>(b2Vec2(0.f, 0.f));
+
+	auto create_body = [&](const b2BodyDef& def) {
+		b2Body* const b = w->CreateBody(&def);
+		body_indices.emplace(b, static_cast<int>(body_indices.size()));
+		return b;
+	};
+
+	const int num_stacks = 24;
+
+	b2Body* const ground = create_body(island_test_body_def(b2_staticBody, b2Vec2(0.f, 0.f)));
+
+	{
+		b2PolygonShape shape;
+		shape.SetAsBox(1000.f, 1.f);
+		ground->CreateFixture(&shape, 0.f);
+	}
+
+	for (int k = 0; k <= num_stacks; ++k) {
+		b2PolygonShape shape;
+		shape.SetAsBox(0.5f, 5.f);
+		create_body(island_test_body_def(b2_staticBody, b2Vec2(-250.f + k * 20.f, 5.f)))->CreateFixture(&shape, 0.f);
+	}
+
+	for (int k = 0; k < num_stacks; ++k) {
+		for (int i = 0; i < 12; ++i) {
+			auto def = island_test_body_def(b2_dynamicBody, b2Vec2(-240.f + k * 20.f + (i % 3) * 0.3f, 2.f + i * 1.1f));
+			def.linearVelocity.Set(static_cast<float>(i % 5 - 2) * 3.f, -5.f - static_cast<float>(i % 3));
+
+			b2PolygonShape shape;
+			shape.SetAsBox(0.5f, 0.5f);
+			create_body(def)->CreateFixture(&shape, 1.f);
+		}
+
+		b2Body* const anchor = create_body(island_test_body_def(b2_staticBody, b2Vec2(-235.f + k * 20.f, 20.f)));
+		auto pendulum_def = island_test_body_def(b2_dynamicBody, b2Vec2(-232.f + k * 20.f, 20.f));
+		pendulum_def.linearVelocity.Set(0.f, -8.f);
+
+		b2Body* const pendulum = create_body(pendulum_def);
+
+		b2CircleShape shape;
+		shape.m_radius = 0.4f;
+		pendulum->CreateFixture(&shape, 1.f);
+
+		b2RevoluteJointDef revolute;
+		revolute.Initialize(anchor, pendulum, anchor->GetPosition());
+		w->CreateJoint(&revolute);
+
+		b2DistanceJointDef distance;
+		distance.Initialize(ground, pendulum, b2Vec2(-232.f + k * 20.f, 1.f), pendulum->GetPosition());
+		w->CreateJoint(&distance);
+	}
+
+	return w;
+}
+
+TEST_CASE("PhysicsSystem ParallelIslandsAreDeterministic") {
+	std::unordered_map<const b2Body*, int> serial_indices;
+	std::unordered_map<const b2Body*, int> parallel_indices;
+
+	auto serial = make_island_test_world(serial_indices);
+	auto parallel = make_island_test_world(parallel_indices);
+
+	post_solve_recorder serial_recorder(serial_indices);
+	post_solve_recorder parallel_recorder(parallel_indices);
+
+	serial->SetContactListener(&serial_recorder);
+	parallel->SetContactListener(&parallel_recorder);
+
+	auto pool = augs::thread_pool(3);
+	counting_executor executor(pool);
+
+	for (int i = 0; i < 300; ++i) {
+		serial->Step(1 / 60.f, 8, 3);
+		parallel->Step(1 / 60.f, 8, 3, &executor);
+	}
+
+	REQUIRE(executor.max_jobs > 1);
+
+	auto same_bytes = [](const auto& x, const auto& y) {
+		return std::memcmp(&x, &y, sizeof(x)) == 0;
+	};
+
+	REQUIRE(serial_recorder.records.size() > 0);
+	REQUIRE(serial_recorder.records.size() == parallel_recorder.records.size());
+
+	for (std::size_t i = 0; i < serial_recorder.records.size(); ++i) {
+		const auto& s = serial_recorder.records[i];
+		const auto& p = parallel_recorder.records[i];
+
+		REQUIRE(s.body_a == p.body_a);
+		REQUIRE(s.body_b == p.body_b);
+		REQUIRE(s.impulse.count == p.impulse.count);
+
+		for (int32 j = 0; j < s.impulse.count; ++j) {
+			REQUIRE(same_bytes(s.impulse.normalImpulses[j], p.impulse.normalImpulses[j]));
+			REQUIRE(same_bytes(s.impulse.tangentImpulses[j], p.impulse.tangentImpulses[j]));
+		}
+	}
+
+	const b2Body* s = serial->GetBodyList();
+	const b2Body* p = parallel->GetBodyList();
+
+	for (; s && p; s = s->GetNext(), p = p->GetNext()) {
+		REQUIRE(same_bytes(s->m_xf, p->m_xf));
+		REQUIRE(same_bytes(s->m_sweep, p->m_sweep));
+		REQUIRE(same_bytes(s->m_linearVelocity, p->m_linearVelocity));
+		REQUIRE(same_bytes(s->m_angularVelocity, p->m_angularVelocity));
+		REQUIRE(s->IsAwake() == p->IsAwake());
+	}
+
+	REQUIRE(s == nullptr);
+	REQUIRE(p == nullptr);
+}
+#endif
@@ -20,6 +20,7 @@
 
 #include "game/stateless_systems/visibility_system.h"
 #include "game/inferred_caches/physics_world_cache.h"
+#include "game/detail/physics/occluder_snapshot.h"
 
 #include "game/components/rigid_body_component.h"
 #include "game/components/transform_component.h"
@@ -167,11 +168,93 @@ bool visibility_information_request::valid() const {
 	return queried_rect.x > 1.f && queried_rect.y > 1.f;
 }
 
+template <class O>
+void calc_visibility_against(
+	const O& occluders,
+	const cosmos& cosm,
+	const visibility_request& request,
+	visibility_response& response,
+	std::vector<debug_line>& lines
+);
+
+/*
+	Answers the occlusion queries directly from the physics world.
+	Has the same interface as occluder_snapshot.
+*/
+
+struct world_occluders {
+	const physics_world_cache& physics;
+
+	template <class F>
+	void for_each_polygon_in_aabb_meters(
+		const b2AABB aabb,
+		const b2Filter filter,
+		const entity_id ignored_entity,
+		F callback
+	) const {
+		physics.for_each_in_aabb_meters(
+			aabb, 
+			filter,
+			[&](const b2Fixture& f) {
+				if (get_body_entity_that_owns(f) == Userdata(ignored_entity)) {
+					return callback_result::CONTINUE;
+				}
+
+				if (f.m_shape->GetType() == b2Shape::e_polygon) {
+					callback(static_cast<const b2PolygonShape&>(*f.m_shape), f.GetBody()->GetTransform());
+				}
+
+				return callback_result::CONTINUE;
+			}
+		);
+	}
+
+	auto ray_cast(const vec2 p1_meters, const vec2 p2_meters, const b2Filter filter, const entity_id ignore_entity) const {
+		return physics.ray_cast(p1_meters, p2_meters, filter, ignore_entity);
+	}
+
+	auto ray_cast_all_intersections(const vec2 p1_meters, const vec2 p2_meters, const b2Filter filter, const entity_id ignore_entity) const {
+		return physics.ray_cast_all_intersections(p1_meters, p2_meters, filter, ignore_entity);
+	}
+};
+
 void visibility_system::calc_visibility(
 	const cosmos& cosm,
 	const visibility_request& request,
 	visibility_response& response
 ) const {
+	calc_visibility_against(
+		world_occluders { cosm.get_solvable_inferred().physics },
+		cosm,
+		request,
+		response,
+		DEBUG_LINES_TARGET
+	);
+}
+
+void visibility_system::calc_visibility(
+	const occluder_snapshot& occluders,
+	const cosmos& cosm,
+	const visibility_request& request,
+	visibility_response& response
+) const {
+	calc_visibility_against(
+		occluders,
+		cosm,
+		request,
+		response,
+		DEBUG_LINES_TARGET
+	);
+}
+
+template <class O>
+void calc_visibility_against(
+	const O& occluders,
+	const cosmos& cosm,
+	const visibility_request& request,
+	visibility_response& response,
+	std::vector<debug_line>& lines
+) {
 	const auto si = cosm.get_si();
 
 	const auto vtx_hit_col = yellow;
@@ -198,8 +281,6 @@ void visibility_system::calc_visibility(
 	}();
 
 
-	auto& lines = DEBUG_LINES_TARGET;
-
 	/* prepare epsilons to be used later, just to make the notation more clear */
 	const auto epsilon_distance_vertex_hit_sq =
 		si.get_meters(settings.epsilon_distance_vertex_hit) *
@@ -208,9 +289,6 @@ void visibility_system::calc_visibility(
 
 	const auto epsilon_threshold_obstacle_hit_meters = si.get_meters(settings.epsilon_threshold_obstacle_hit);
 
-	/* we'll need a reference to physics system for raycasting */
-	const auto& physics = cosm.get_solvable_inferred().physics;
-
 	struct ray_input {
 		vec2 destination;
 	};
@@ -295,98 +373,87 @@ void visibility_system::calc_visibility(
 	};
 
 	/* for every fixture that intersected with the visibility square */
-	physics.for_each_in_aabb_meters(
+	occluders.for_each_polygon_in_aabb_meters(
 		aabb, 
 		request.filter,
-		[&](const b2Fixture& f) {
-			if (get_body_entity_that_owns(f) == Userdata(ignored_entity)) {
-				return callback_result::CONTINUE;
-			}
-
-			const auto& shape = *f.m_shape;
-			const auto xf = f.GetBody()->GetTransform();
+		ignored_entity,
+		[&](const b2PolygonShape& poly, const b2Transform xf) {
 			const auto eye_local = vec2(b2MulT(xf.q, eye_meters.operator b2Vec2() - xf.p));
 
-			if (shape.GetType() == b2Shape::e_polygon) {
-				const auto& poly = static_cast<const b2PolygonShape&>(shape);
-
-				std::array<bool, b2_maxPolygonVertices> invisible_edges = {};
+			std::array<bool, b2_maxPolygonVertices> invisible_edges = {};
 
-				const auto vn = poly.GetVertexCount();
+			const auto vn = poly.GetVertexCount();
 
-				for (int vp = 0; vp < vn; ++vp) {
-					const auto this_idx = vp;
-					const auto next_idx = (vp + 1) % vn;
+			for (int vp = 0; vp < vn; ++vp) {
+				const auto this_idx = vp;
+				const auto next_idx = (vp + 1) % vn;
 
-					const auto vert = poly.GetVertex(this_idx);
-					const auto next_vert = poly.GetVertex(next_idx);
+				const auto vert = poly.GetVertex(this_idx);
+				const auto next_vert = poly.GetVertex(next_idx);
 
-					const auto side = (eye_local - vert).cross(next_vert - vert);
+				const auto side = (eye_local - vert).cross(next_vert - vert);
 
-					if (augs::is_zero(side)) {
-						/* A collinear edge. The closer vertex is always visible, the further is not. */
+				if (augs::is_zero(side)) {
+					/* A collinear edge. The closer vertex is always visible, the further is not. */
 
-						if (eye_local - vec2(vert) < eye_local - vec2(next_vert)) {
-							VIS_LOG("Collinear and visible:");
-							invisible_edges[next_idx] = true;
-						}
-						else {
-							VIS_LOG("Collinear and invisible:");
-							invisible_edges[this_idx] = true;
-						}
+					if (eye_local - vec2(vert) < eye_local - vec2(next_vert)) {
+						VIS_LOG("Collinear and visible:");
+						invisible_edges[next_idx] = true;
 					}
 					else {
-						if (side > 0.f) {
-							VIS_LOG("Visible (%x):", side);
-						}
-						else {
-							VIS_LOG("Invisible (%x):", side);
-							invisible_edges[this_idx] = true;
-						}
+						VIS_LOG("Collinear and invisible:");
+						invisible_edges[this_idx] = true;
+					}
+				}
+				else {
+					if (side > 0.f) {
+						VIS_LOG("Visible (%x):", side);
+					}
+					else {
+						VIS_LOG("Invisible (%x):", side);
+						invisible_edges[this_idx] = true;
 					}
-
-					VIS_LOG_NVPS(vec2(vert), vp, invisible_edges[vp]);
 				}
 
-				auto idx = [vn](int i) {
-					return i < 0 ? vn + i : i % vn;
-				};
+				VIS_LOG_NVPS(vec2(vert), vp, invisible_edges[vp]);
+			}
 
-				VIS_LOG("Setting visions");
+			auto idx = [vn](int i) {
+				return i < 0 ? vn + i : i % vn;
+			};
 
-				for (int vp = 0; vp < vn; ++vp) {
-					const auto vert = poly.GetVertex(vp);
-					const auto vv = static_cast<vec2>(b2Mul(xf, vert));
+			VIS_LOG("Setting visions");
 
-					const bool this_vis = !invisible_edges[vp];
-					const bool prev_vis = !invisible_edges[idx(vp - 1)];
+			for (int vp = 0; vp < vn; ++vp) {
+				const auto vert = poly.GetVertex(vp);
+				const auto vv = static_cast<vec2>(b2Mul(xf, vert));
 
-					VIS_LOG_NVPS(prev_vis, this_vis);
+				const bool this_vis = !invisible_edges[vp];
+				const bool prev_vis = !invisible_edges[idx(vp - 1)];
 
-					if (!this_vis && !prev_vis) {
-						VIS_LOG("Surely invisible");
-						add_surely_invisible(vv);
-						continue;
-					}
+				VIS_LOG_NVPS(prev_vis, this_vis);
 
-					if (const auto entry = push_vertex_if_within_range(vv)) {
-						if (prev_vis && this_vis) {
-							entry->vision_extends = 0;
-						}
-						else if (prev_vis && !this_vis) {
-							entry->vision_extends = -1;
-						}
-						else if (!prev_vis && this_vis) {
-							entry->vision_extends = 1;
-						}
+				if (!this_vis && !prev_vis) {
+					VIS_LOG("Surely invisible");
+					add_surely_invisible(vv);
+					continue;
+				}
 
-						VIS_LOG("Pushed %x", vp);
-						VIS_LOG_NVPS(si.get_pixels(vv), entry->vision_extends);
+				if (const auto entry = push_vertex_if_within_range(vv)) {
+					if (prev_vis && this_vis) {
+						entry->vision_extends = 0;
+					}
+					else if (prev_vis && !this_vis) {
+						entry->vision_extends = -1;
 					}
+					else if (!prev_vis && this_vis) {
+						entry->vision_extends = 1;
+					}
+
+					VIS_LOG("Pushed %x", vp);
+					VIS_LOG_NVPS(si.get_pixels(vv), entry->vision_extends);
 				}
 			}
-
-			return callback_result::CONTINUE;
 		}
 	);
 
@@ -422,8 +489,8 @@ void visibility_system::calc_visibility(
 		/* raycast through the bounds to add another vertices where the shapes go beyond visibility square */
 		for (const auto& bound : b) {
 			/* have to raycast both directions because Box2D ignores the second side of the fixture */
-			const auto output1 = physics.ray_cast_all_intersections(bound.m_vertex1, bound.m_vertex2, request.filter, ignored_entity);
-			const auto output2 = physics.ray_cast_all_intersections(bound.m_vertex2, bound.m_vertex1, request.filter, ignored_entity);
+			const auto output1 = occluders.ray_cast_all_intersections(bound.m_vertex1, bound.m_vertex2, request.filter, ignored_entity);
+			const auto output2 = occluders.ray_cast_all_intersections(bound.m_vertex2, bound.m_vertex1, request.filter, ignored_entity);
 
 			/* check for duplicates */
 			std::vector<vec2> output;
@@ -599,7 +666,7 @@ void visibility_system::calc_visibility(
 
 	/* All raycast inputs are processed at once to improve cache coherency. */
 	for (std::size_t j = 0; j < all_ray_inputs.size(); ++j) {
-		auto result = physics.ray_cast(eye_meters, all_ray_inputs[j].destination, request.filter, ignored_entity);
+		auto result = occluders.ray_cast(eye_meters, all_ray_inputs[j].destination, request.filter, ignored_entity);
 		all_ray_outputs.emplace_back(std::move(result));
 
 #if LOG_VISIBILITY
@@ -5,6 +5,8 @@
 #include "game/debug_drawing_settings.h"
 #include "game/cosmos/step_declaration.h"
 
+class occluder_snapshot;
+
 using visibility_request = messages::visibility_information_request;
 using visibility_response = messages::visibility_information_response;
 
@@ -25,4 +27,12 @@ public:
 		const visibility_request&,
 		visibility_response&
 	) const;
+
+	/* Does not touch the physics world, so any number of these may run concurrently. */
+	void calc_visibility(
+		const occluder_snapshot&,
+		const cosmos&,
+		const visibility_request&,
+		visibility_response&
+	) const;
 };
\ No newline at end of file
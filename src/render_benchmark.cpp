@@ -0,0 +1,363 @@
+#include <memory>
+
+#include "augs/log.h"
+#include "augs/templates/thread_pool.h"
+#include "augs/misc/timing/timer.h"
+#include "augs/filesystem/file.h"
+#include "augs/graphics/renderer.h"
+#include "augs/graphics/renderer_backend.h"
+#include "augs/graphics/recording_renderer_backend.h"
+#include "augs/image/font.h"
+
+#include "game/cosmos/cosmos.h"
+#include "game/cosmos/for_each_entity.h"
+#include "game/cosmos/solvers/standard_solver.h"
+#include "game/modes/mode_entropy.h"
+#include "game/detail/visible_entities.h"
+#include "game/detail/static_render_chunks.h"
+
+#include "view/audiovisual_state/audiovisual_state.h"
+#include "view/rendering_scripts/illuminated_rendering.h"
+#include "application/main/cached_visibility_data.h"
+#include "view/rendering_scripts/launch_visibility_jobs.h"
+#include "view/rendering_scripts/for_each_vis_request.h"
+#include "view/viewables/images_in_atlas_map.h"
+#include "view/viewables/loaded_sounds_map.h"
+#include "view/frame_profiler.h"
+
+#include "application/config_lua_table.h"
+
+#include "benchmark_arena.h"
+#include "tick_benchmark.h"
+#include "render_benchmark.h"
+
+/*
+	Renders the frames of an arena through illuminated_rendering,
+	but hands the resulting commands to a recording_renderer_backend instead of the GPU,
+	so that the cost of the rendering scripts and the size of the command stream
+	can be compared across releases without any graphics hardware.
+
+	See benchmark_arena for where the frames come from.
+
+	Images are not streamed, so every sprite samples an empty atlas entry.
+	The geometry is the same as in the game, except that the neon maps are never drawn.
+*/
+
+bool perform_render_benchmark(sol::state& lua, const render_benchmark_settings& settings, const render_benchmark_input& in) {
+	LOG("(Render benchmark) Rendering %x frames of \"%x\", %x steps apart.", settings.frames, settings.arena, settings.ticks_per_frame);
+
+	if (settings.frames <= 0) {
+		return true;
+	}
+
+	auto loaded = benchmark_arena();
+
+	if (const auto error = loaded.load(lua, settings.arena, settings.bots)) {
+		LOG("(Render benchmark) Failed to load the arena: %x", *error);
+		return false;
+	}
+
+	const auto arena = loaded.get_handle();
+	const auto& cosm = arena.get_cosmos();
+	const auto& config = in.config;
+
+	/* Heap-allocated as these are big. */
+
+	const auto audiovisuals = std::make_unique<audiovisual_state>();
+	const auto renderer = std::make_unique<augs::renderer>();
+	const auto game_images = std::make_unique<images_in_atlas_map>();
+	const auto necessary_images = std::make_unique<necessary_images_in_atlas_map>();
+	const auto fonts = std::make_unique<all_loaded_gui_fonts>();
+
+	const auto no_sounds = loaded_sounds_map();
+	const auto no_highlights = std::vector<additional_highlight>();
+	const auto no_indicators = std::vector<special_indicator>();
+	const auto indicator_meta = special_indicator_meta();
+
+	visible_entities all_visible;
+	static_render_chunks all_static_chunks;
+	cached_visibility_data cached_visibility;
+	particle_triangle_buffers particles;
+	frame_profiler frame_performance;
+
+	augs::graphics::recording_renderer_backend backend;
+	renderer_backend_result backend_result;
+
+	std::vector<double> rendering_times;
+	std::vector<double> recording_times;
+
+	std::vector<double> drawcalls;
+	std::vector<double> vertices;
+	std::vector<double> state_changes;
+	std::vector<double> texture_binds;
+
+	rendering_times.reserve(settings.frames);
+	recording_times.reserve(settings.frames);
+
+	auto& pool = in.pool;
+
+	/* Follows the first character of the arena, as a spectator would. */
+
+	auto find_viewed_character = [&]() {
+		auto viewed = entity_id();
+
+		cosm.for_each_having<components::sentience>(
+			[&](const auto& typed_handle) {
+				if (!viewed.is_set()) {
+					viewed = typed_handle.get_id();
+				}
+			}
+		);
+
+		return cosm[viewed];
+	};
+
+	const auto frame_delta = augs::delta::from_milliseconds(arena.get_inv_tickrate() * settings.ticks_per_frame * 1000.0);
+
+	auto total_timer = augs::timer();
+
+	for (int i = 0; i < settings.frames; ++i) {
+		for (int t = 0; t < settings.ticks_per_frame; ++t) {
+			arena.advance(
+				mode_entropy(),
+				solver_callbacks(
+					default_solver_callback(),
+					[&](const const_logic_step step) {
+						audiovisuals->standard_post_solve(step, {
+							nullptr,
+							loaded.scene->viewables.particle_effects,
+							no_sounds,
+							config.audio_volume,
+							config.sound,
+							character_camera { find_viewed_character(), { camera_eye(), in.screen_size } },
+							config.performance,
+							config.damage_indication,
+							audiovisual_post_solve_settings()
+						});
+					}
+				),
+				solve_settings()
+			);
+		}
+
+		const auto viewed_character = find_viewed_character();
+		const auto& interp = audiovisuals->get<interpolation_system>();
+		const auto viewed_transform = viewed_character ? viewed_character.find_viewing_transform(interp) : std::optional<transformr>();
+
+		auto eye = camera_eye();
+
+		if (viewed_transform) {
+			eye.transform.pos = viewed_transform->pos;
+			eye.transform.pos.discard_fract();
+		}
+
+		const auto cone = camera_cone(eye, in.screen_size);
+
+		const auto queried_cone = [&]() {
+			auto c = cone;
+			c.eye.zoom /= config.session.camera_query_aabb_mult;
+			return c;
+		}();
+
+		const auto camera = character_camera { viewed_character, cone };
+
+		all_visible.reacquire_all({
+			cosm,
+			queried_cone,
+			accuracy_type::PROXIMATE,
+			visible_entities_query::dont_filter(),
+			tree_of_npo_filter::all(),
+			std::addressof(all_static_chunks)
+		});
+
+		all_visible.sort(cosm);
+
+		audiovisuals->advance(audiovisual_advance_input {
+			in.audio_buffers,
+			nullptr,
+			frame_delta,
+			1.0,
+			arena.get_inv_tickrate(),
+
+			camera,
+			queried_cone,
+			all_visible,
+
+			loaded.scene->viewables.particle_effects,
+			cosm.get_logical_assets().plain_animations,
+
+			no_sounds,
+
+			config.audio_volume,
+			config.sound,
+			config.performance,
+
+			*game_images,
+			particles,
+			renderer->dedicated,
+			frame_delta,
+
+			config.damage_indication,
+
+			pool
+		});
+
+		auto& light_requests = cached_visibility.light_requests;
+		light_requests.clear();
+
+		::for_each_vis_request(
+			[&](const visibility_request& request) {
+				light_requests.emplace_back(request);
+			},
+
+			cosm,
+			all_visible,
+
+			audiovisuals->get<light_system>().per_entity_cache,
+			interp,
+			queried_cone.get_visible_world_rect_aabb()
+		);
+
+		const auto& fog_of_war = config.drawing.fog_of_war;
+
+#if BUILD_STENCIL_BUFFER
+		const bool fog_of_war_effective = viewed_transform != std::nullopt && fog_of_war.is_enabled();
+#else
+		const bool fog_of_war_effective = false;
+#endif
+
+		auto rendering_timer = augs::timer();
+
+		::enqueue_visibility_jobs(
+			pool,
+
+			cosm,
+			renderer->dedicated,
+			cached_visibility,
+
+			fog_of_war_effective,
+			viewed_character,
+			viewed_transform ? *viewed_transform : transformr(),
+			fog_of_war
+		);
+
+		const auto illuminated_input = illuminated_rendering_input {
+			camera,
+			queried_cone,
+			vec2::zero,
+			*audiovisuals,
+			config.drawing,
+			*necessary_images,
+			*fonts,
+			*game_images,
+			0.0,
+			*renderer,
+			frame_performance,
+			nullptr,
+			in.fbos,
+			in.shaders,
+			all_visible,
+			config.performance,
+			config.renderer,
+			no_highlights,
+			no_indicators,
+			indicator_meta,
+			particles,
+			config.damage_indication,
+			light_requests,
+			pool
+		};
+
+		pool.enqueue([&]() { illuminated_rendering(illuminated_input); });
+		::enqueue_illuminated_rendering_jobs(pool, illuminated_input);
+
+		pool.submit();
+		pool.help_until_no_tasks();
+		pool.wait_for_all_tasks_to_complete();
+
+		rendering_times.push_back(rendering_timer.get<std::chrono::seconds>());
+
+		const auto previous = backend.stats;
+
+		auto recording_timer = augs::timer();
+
+		backend.perform(
+			backend_result,
+			renderer->commands.data(),
+			renderer->commands.size(),
+			renderer->dedicated
+		);
+
+		recording_times.push_back(recording_timer.get<std::chrono::seconds>());
+
+		const auto& now = backend.stats;
+
+		drawcalls.push_back(static_cast<double>(now.drawcalls - previous.drawcalls));
+		vertices.push_back(static_cast<double>(now.vertices - previous.vertices));
+		state_changes.push_back(static_cast<double>(now.state_changes - previous.state_changes));
+		texture_binds.push_back(static_cast<double>(now.texture_binds - previous.texture_binds));
+
+		backend_result.clear();
+		renderer->next_frame();
+	}
+
+	const auto total_secs = total_timer.get<std::chrono::seconds>();
+	const auto& totals = backend.stats;
+
+	const auto report = typesafe_sprintf(
+		"{\n"
+		"\t\"arena\": \"%x\",\n"
+		"\t\"frames\": %x,\n"
+		"\t\"ticks_per_frame\": %x,\n"
+		"\t\"bots\": %x,\n"
+		"\t\"screen_size\": [%x, %x],\n"
+		"\t\"total_secs\": %x,\n"
+		"\t\"time_unit\": \"ms\",\n"
+		"\t\"rendering\": %x,\n"
+		"\t\"recording\": %x,\n"
+		"\t\"per_frame\": {\n"
+		"\t\t\"drawcalls\": %x,\n"
+		"\t\t\"vertices\": %x,\n"
+		"\t\t\"state_changes\": %x,\n"
+		"\t\t\"texture_binds\": %x\n"
+		"\t},\n"
+		"\t\"totals\": { \"commands\": %x, \"drawcall_commands\": %x, \"drawcalls\": %x, \"vertices\": %x, \"uploaded_bytes\": %x, \"state_changes\": %x, \"texture_binds\": %x, \"shader_binds\": %x, \"fbo_binds\": %x, \"uniform_sets\": %x, \"texture_uploads\": %x }\n"
+		"}\n",
+		settings.arena,
+		settings.frames,
+		settings.ticks_per_frame,
+		settings.bots,
+		in.screen_size.x,
+		in.screen_size.y,
+		total_secs,
+		make_benchmark_summary_json(rendering_times, 1000.0),
+		make_benchmark_summary_json(recording_times, 1000.0),
+		make_benchmark_summary_json(drawcalls, 1.0),
+		make_benchmark_summary_json(vertices, 1.0),
+		make_benchmark_summary_json(state_changes, 1.0),
+		make_benchmark_summary_json(texture_binds, 1.0),
+		totals.commands,
+		totals.drawcall_commands,
+		totals.drawcalls,
+		totals.vertices,
+		totals.uploaded_bytes,
+		totals.state_changes,
+		totals.texture_binds,
+		totals.shader_binds,
+		totals.fbo_binds,
+		totals.uniform_sets,
+		totals.texture_uploads
+	);
+
+	LOG("(Render benchmark) Took %x secs. Writing the report to: %x", total_secs, settings.report_filename);
+
+	try {
+		augs::save_as_text(settings.report_filename, report);
+	}
+	catch (const std::exception& err) {
+		LOG("(Render benchmark) Failed to write the report: %x", err.what());
+		return false;
+	}
+
+	return true;
+}
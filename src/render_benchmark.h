@@ -0,0 +1,36 @@
+#pragma once
+#include <string>
+#include "augs/math/vec2.h"
+#include "augs/filesystem/path_declaration.h"
+
+namespace sol {
+	class state;
+}
+
+namespace augs {
+	class thread_pool;
+	class audio_command_buffers;
+}
+
+struct config_lua_table;
+struct all_necessary_fbos;
+struct all_necessary_shaders;
+
+struct render_benchmark_settings {
+	std::string arena;
+	int frames = 0;
+	int ticks_per_frame = 1;
+	int bots = -1;
+	augs::path_type report_filename;
+};
+
+struct render_benchmark_input {
+	const config_lua_table& config;
+	const vec2i screen_size;
+	all_necessary_fbos& fbos;
+	const all_necessary_shaders& shaders;
+	augs::audio_command_buffers& audio_buffers;
+	augs::thread_pool& pool;
+};
+
+bool perform_render_benchmark(sol::state& lua, const render_benchmark_settings&, const render_benchmark_input&);
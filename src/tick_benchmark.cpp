@@ -0,0 +1,180 @@
+#include <cmath>
+#include <algorithm>
+#include <map>
+#include <memory>
+
+#include "augs/log.h"
+#include "augs/templates/introspect.h"
+#include "augs/templates/thread_pool.h"
+#include "augs/misc/timing/timer.h"
+#include "augs/filesystem/file.h"
+
+#include "game/cosmos/cosmos.h"
+#include "game/cosmos/solvers/standard_solver.h"
+#include "game/modes/mode_entropy.h"
+
+#include "benchmark_arena.h"
+#include "tick_benchmark.h"
+
+/*
+	Advances an arena headlessly and reports what every section of the logic step cost,
+	so that tick-time regressions can be caught by comparing reports across releases.
+
+	See benchmark_arena for where the load comes from.
+*/
+
+struct tick_benchmark_samples {
+	bool is_time = false;
+	std::vector<double> values;
+};
+
+std::string make_benchmark_summary_json(std::vector<double>& values, const double mult) {
+	std::sort(values.begin(), values.end());
+
+	const auto n = values.size();
+
+	auto percentile = [&](const double p) {
+		const auto rank = static_cast<std::size_t>(std::ceil(p * n));
+		return values[std::min(n - 1, rank > 0 ? rank - 1 : 0)] * mult;
+	};
+
+	double total = 0.0;
+
+	for (const auto v : values) {
+		total += v;
+	}
+
+	return typesafe_sprintf(
+		"{ \"samples\": %x, \"mean\": %x, \"p50\": %x, \"p90\": %x, \"p99\": %x, \"max\": %x }",
+		n,
+		total / n * mult,
+		percentile(0.5),
+		percentile(0.9),
+		percentile(0.99),
+		values.back() * mult
+	);
+}
+
+bool perform_tick_benchmark(sol::state& lua, const tick_benchmark_settings& settings) {
+	LOG("(Tick benchmark) Advancing \"%x\" by %x steps.", settings.arena, settings.ticks);
+
+	if (settings.ticks <= 0) {
+		return true;
+	}
+
+	auto loaded = benchmark_arena();
+
+	if (const auto error = loaded.load(lua, settings.arena, settings.bots)) {
+		LOG("(Tick benchmark) Failed to load the arena: %x", *error);
+		return false;
+	}
+
+	const auto arena = loaded.get_handle();
+
+	auto logic_pool = augs::thread_pool(settings.num_logic_pool_workers);
+
+	auto solve = solve_settings();
+
+	if (logic_pool.size() > 0) {
+		solve.logic_pool = std::addressof(logic_pool);
+	}
+
+	auto& profiler = arena.advanced_cosm.profiler;
+
+	std::map<std::string, tick_benchmark_samples> samples;
+	std::vector<double> whole_steps;
+
+	/*
+		Measurements are compared before and after each step,
+		so that a section measured several times in one step is reported as their sum,
+		and a section not reached at all does not get a sample.
+	*/
+
+	std::map<std::string, std::pair<std::size_t, double>> previous;
+
+	auto gather = [&](const bool record) {
+		cosmic_profiler::for_each_measurement(
+			[&](const auto& label, const auto& m) {
+				using T = remove_cref<decltype(m)>;
+
+				const auto key = std::string(label);
+				const auto now = std::make_pair(m.get_num_measurements(), static_cast<double>(m.get_total_units()));
+				auto& last = previous[key];
+
+				if (record && now.first != last.first) {
+					auto& s = samples[key];
+
+					s.is_time = std::is_same_v<T, augs::time_measurements>;
+					s.values.push_back(now.second - last.second);
+				}
+
+				last = now;
+			},
+			profiler
+		);
+	};
+
+	gather(false);
+
+	whole_steps.reserve(settings.ticks);
+
+	auto total_timer = augs::timer();
+
+	for (int i = 0; i < settings.ticks; ++i) {
+		auto step_timer = augs::timer();
+
+		arena.advance(mode_entropy(), solver_callbacks(), solve);
+
+		whole_steps.push_back(step_timer.get<std::chrono::seconds>());
+
+		gather(true);
+	}
+
+	const auto total_secs = total_timer.get<std::chrono::seconds>();
+
+	std::string sections;
+
+	for (auto& s : samples) {
+		if (!sections.empty()) {
+			sections += ",\n";
+		}
+
+		sections += typesafe_sprintf(
+			"\t\t\"%x\": %x",
+			s.first,
+			make_benchmark_summary_json(s.second.values, s.second.is_time ? 1000.0 : 1.0)
+		);
+	}
+
+	const auto report = typesafe_sprintf(
+		"{\n"
+		"\t\"arena\": \"%x\",\n"
+		"\t\"ticks\": %x,\n"
+		"\t\"bots\": %x,\n"
+		"\t\"logic_pool_workers\": %x,\n"
+		"\t\"total_secs\": %x,\n"
+		"\t\"time_unit\": \"ms\",\n"
+		"\t\"whole_step\": %x,\n"
+		"\t\"sections\": {\n%x\n\t}\n"
+		"}\n",
+		settings.arena,
+		settings.ticks,
+		settings.bots,
+		logic_pool.size(),
+		total_secs,
+		make_benchmark_summary_json(whole_steps, 1000.0),
+		sections
+	);
+
+	LOG("(Tick benchmark) Took %x secs. Writing the report to: %x", total_secs, settings.report_filename);
+
+	try {
+		augs::save_as_text(settings.report_filename, report);
+	}
+	catch (const std::exception& err) {
+		LOG("(Tick benchmark) Failed to write the report: %x", err.what());
+		return false;
+	}
+
+	return true;
+}
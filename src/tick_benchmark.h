@@ -0,0 +1,21 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "augs/filesystem/path_declaration.h"
+
+namespace sol {
+	class state;
+}
+
+struct tick_benchmark_settings {
+	std::string arena;
+	int ticks = 0;
+	int bots = -1;
+	unsigned num_logic_pool_workers = 0;
+	augs::path_type report_filename;
+};
+
+bool perform_tick_benchmark(sol::state& lua, const tick_benchmark_settings&);
+
+/* Sorts the values and formats their count, mean, percentiles and maximum as a JSON object. */
+std::string make_benchmark_summary_json(std::vector<double>& values, double mult);
@@ -399,20 +399,24 @@ void particles_simulation_system::integrate_and_draw_all_particles(const integra
 	auto generic_integrate = [&anims, delta](const particle_layer, auto& range, int, int from_i, const int till_i, auto&&... args) {
 		using P = typename remove_cref<decltype(range)>::value_type;
 
-		for (; from_i < till_i; ++from_i) {
-			auto& particle = range[from_i];
-
-			if constexpr(std::is_same_v<P, general_particle>) {
-				particle.integrate(delta);
-			}
-			else if constexpr(std::is_same_v<P, animated_particle>) {
-				particle.integrate(delta, anims);
-			}
-			else if constexpr(std::is_same_v<P, homing_animated_particle>) {
-				particle.integrate(delta, anims, std::forward<decltype(args)>(args)...);
+		if constexpr(std::is_same_v<P, general_particle>) {
+			if (from_i < till_i) {
+				integrate_general_particles(range.data() + from_i, static_cast<std::size_t>(till_i - from_i), delta);
 			}
-			else {
-				static_assert(always_false_v<P>, "Unimplemented!");
+		}
+		else {
+			for (; from_i < till_i; ++from_i) {
+				auto& particle = range[from_i];
+
+				if constexpr(std::is_same_v<P, animated_particle>) {
+					particle.integrate(delta, anims);
+				}
+				else if constexpr(std::is_same_v<P, homing_animated_particle>) {
+					particle.integrate(delta, anims, std::forward<decltype(args)>(args)...);
+				}
+				else {
+					static_assert(always_false_v<P>, "Unimplemented!");
+				}
 			}
 		}
 	};
@@ -453,23 +457,23 @@ void particles_simulation_system::integrate_and_draw_all_particles(const integra
 		}
 	};
 
-	auto integrate_worker = [this, &cosm, &interp, generic_integrate](const int from, const int to) {
-		for_each_particle_in_range(
-			cosm,
-			interp,
-			from,
-			to, 
-			generic_integrate
-		);
+	/*
+		Draw every run right after integrating it,
+		while the particles are still in cache.
+	*/
+
+	auto generic_integrate_and_draw = [generic_integrate, generic_draw](const particle_layer p, auto& range, const int layer_index, const int from_i, const int till_i, auto&&... args) {
+		generic_integrate(p, range, layer_index, from_i, till_i, args...);
+		generic_draw(p, range, layer_index, from_i, till_i);
 	};
 
-	auto draw_worker = [this, &cosm, &interp, generic_draw](const int from, const int to) {
+	auto integrate_and_draw_worker = [this, &cosm, &interp, generic_integrate_and_draw](const int from, const int to) {
 		for_each_particle_in_range(
 			cosm,
 			interp,
-			from, 
+			from,
 			to, 
-			generic_draw
+			generic_integrate_and_draw
 		);
 	};
 
@@ -488,9 +492,8 @@ void particles_simulation_system::integrate_and_draw_all_particles(const integra
 		const auto from = i * per_job_n;
 		const auto to = is_last ? total_n : from + per_job_n;
 
-		in.pool.enqueue([from, to, integrate_worker, draw_worker]() {
-			integrate_worker(from, to);
-			draw_worker(from, to);
+		in.pool.enqueue([from, to, integrate_and_draw_worker]() {
+			integrate_and_draw_worker(from, to);
 		});
 	}
 }
@@ -814,3 +817,63 @@ void particles_simulation_system::advance_visible_streams(
 		settings
 	);
 }
+
+#if BUILD_UNIT_TESTS
+#include <Catch/single_include/catch2/catch.hpp>
+
+TEST_CASE("ParticlesSimulation RunKernelMatchesScalar") {
+	randomization rng(1337);
+
+	std::vector<general_particle> particles(103);
+
+	for (auto& p : particles) {
+		p.pos = vec2(rng.randval(-1000.f, 1000.f), rng.randval(-1000.f, 1000.f));
+		p.vel = vec2(rng.randval(-400.f, 400.f), rng.randval(-400.f, 400.f));
+		p.acc = vec2(rng.randval(-50.f, 50.f), rng.randval(-50.f, 50.f));
+		p.rotation = rng.randval(-180.f, 180.f);
+		p.rotation_speed = rng.randval(-720.f, 720.f);
+		p.linear_damping = rng.randval(0.f, 2000.f);
+		p.angular_damping = rng.randval(0.f, 2000.f);
+		p.max_lifetime_ms = rng.randval(100.f, 1000.f);
+	}
+
+	/* Edge cases of the masks */
+	particles[0].vel = vec2::zero;
+	particles[1].rotation_speed = -0.f;
+	particles[2].linear_damping = 0.f;
+	particles[2].vel = vec2::zero;
+	particles[2].acc = vec2::zero;
+
+	auto reference = particles;
+	const auto dt = 1.f / 144;
+
+	for (int step = 0; step < 10; ++step) {
+		integrate_general_particles(particles.data(), particles.size(), dt);
+
+		for (auto& p : reference) {
+			integrate_general_particle_branchless(p, dt, dt * 1000);
+		}
+	}
+
+	const auto bits = [](const float f) {
+		uint32_t out;
+		std::memcpy(&out, &f, sizeof(out));
+		return out;
+	};
+
+	for (std::size_t i = 0; i < particles.size(); ++i) {
+		const auto& a = particles[i];
+		const auto& b = reference[i];
+
+		REQUIRE(bits(a.pos.x) == bits(b.pos.x));
+		REQUIRE(bits(a.pos.y) == bits(b.pos.y));
+		REQUIRE(bits(a.vel.x) == bits(b.vel.x));
+		REQUIRE(bits(a.vel.y) == bits(b.vel.y));
+		REQUIRE(bits(a.rotation) == bits(b.rotation));
+		REQUIRE(bits(a.rotation_speed) == bits(b.rotation_speed));
+		REQUIRE(bits(a.linear_damping) == bits(b.linear_damping));
+		REQUIRE(bits(a.angular_damping) == bits(b.angular_damping));
+		REQUIRE(bits(a.current_lifetime_ms) == bits(b.current_lifetime_ms));
+	}
+}
+#endif
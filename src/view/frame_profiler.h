@@ -7,6 +7,7 @@ struct frame_profiler : public augs::profiler_mixin<frame_profiler> {
 	// GEN INTROSPECTOR struct frame_profiler
 	augs::time_measurements total;
 	augs::amount_measurements<std::size_t> num_triangles = 1;
+	augs::amount_measurements<std::size_t> num_drawcalls = 1;
 	augs::amount_measurements<std::size_t> visibility_raycasts = 1;
 
 	augs::time_measurements rendering_script;
@@ -1,6 +1,7 @@
 #pragma once
 #include "view/rendering_scripts/vis_response_to_triangles.h"
 #include "game/enums/filters.h"
+#include "game/detail/physics/occluder_snapshot.h"
 
 inline void enqueue_visibility_jobs(
 	augs::thread_pool& pool,
@@ -17,6 +18,41 @@ inline void enqueue_visibility_jobs(
 	using DV = augs::dedicated_buffer_vector;
 	using D = augs::dedicated_buffer;
 
+	visibility_request fow_request;
+	fow_request.eye_transform = viewed_character_transform;
+	fow_request.filter = predefined_queries::line_of_sight();
+	fow_request.queried_rect = fog_of_war.get_real_size();
+	fow_request.subject = subject;
+
+	/*
+		Every job copies only the occluders its own request can reach,
+		into a snapshot that the worker thread keeps between frames.
+		The copying and the indexing then run in parallel, like the queries.
+	*/
+
+	const auto& physics = cosm.get_solvable_inferred().physics;
+	const auto si = cosm.get_si();
+
+	auto reach_of = [si](const visibility_request& request) {
+		/* Rays may slightly overshoot the queried rect, whichever way it is rotated. */
+		const auto eye = request.eye_transform.pos + request.offset;
+		const auto side = request.queried_rect.bigger_side() * 1.5f + 20.f;
+		const auto reach = ltrb::center_and_size(eye, vec2::square(side));
+
+		b2AABB region;
+		region.lowerBound = b2Vec2(si.get_meters(reach.left_top()));
+		region.upperBound = b2Vec2(si.get_meters(reach.right_bottom()));
+
+		return region;
+	};
+
+	auto calc_visibility = [&physics, &cosm](const b2AABB region, const visibility_request& request, visibility_response& response) {
+		thread_local occluder_snapshot occluders;
+		occluders.rebuild(physics, region);
+
+		visibility_system(DEBUG_FRAME_LINES).calc_visibility(occluders, cosm, request, response);
+	};
+
 	auto launch_light_jobs = [&]() {
 		const auto& light_requests = cached_visibility.light_requests;
 		const auto lights_n = light_requests.size();
@@ -38,8 +74,8 @@ inline void enqueue_visibility_jobs(
 
 			auto& triangles = light_triangles_vectors[i].triangles;
 
-			auto light_job = [&cosm, request, &response, &triangles]() {
-				visibility_system(DEBUG_FRAME_LINES).calc_visibility(cosm, request, response);
+			auto light_job = [calc_visibility, region = reach_of(request), request, &response, &triangles]() {
+				calc_visibility(region, request, response);
 				vis_response_to_triangles(response, triangles, request.color, request.eye_transform.pos);
 			};
 
@@ -50,19 +86,13 @@ inline void enqueue_visibility_jobs(
 	launch_light_jobs();
 
 	if (fow_effective) {
-		const auto fow_size = fog_of_war.get_real_size();
-
-		visibility_request request;
-		request.eye_transform = viewed_character_transform;
-		request.filter = predefined_queries::line_of_sight();
-		request.queried_rect = fow_size;
-		request.subject = subject;
+		const auto& request = fow_request;
 
 		auto& fow_response = cached_visibility.fow_response;
 		auto& fow_triangles = dedicated[D::FOG_OF_WAR].triangles;
 
-		auto fow_job = [request, &cosm, &fow_response, &fow_triangles]() {
-			visibility_system(DEBUG_FRAME_LINES).calc_visibility(cosm, request, fow_response);
+		auto fow_job = [calc_visibility, region = reach_of(request), request, &fow_response, &fow_triangles]() {
+			calc_visibility(region, request, fow_response);
 			vis_response_to_triangles(fow_response, fow_triangles, white, request.eye_transform.pos);
 		};
 
@@ -82,7 +82,8 @@ std::optional<cached_neon_map_in> image_definition_view::should_regenerate_neon_
 }
 
 void image_definition_view::regenerate_neon_map(
-	const cached_neon_map_in& cached_in
+	const cached_neon_map_in& cached_in,
+	augs::thread_pool* const tile_workers
 ) const {
 	const auto diffuse_path = resolved_source_path;
 
@@ -90,7 +91,8 @@ void image_definition_view::regenerate_neon_map(
 		diffuse_path,
 		find_generated_neon_map_path().value(),
 		get_def().meta.extra_loadables.generate_neon_map.value,
-		cached_in
+		cached_in,
+		tile_workers
 	);
 }
 
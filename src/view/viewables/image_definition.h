@@ -58,7 +58,7 @@ struct image_definition_view : asset_definition_view<const image_definition> {
 	void regenerate_desaturation(const bool force_regenerate) const;
 
 	std::optional<cached_neon_map_in> should_regenerate_neon_map(const bool force_regenerate) const;
-	void regenerate_neon_map(const cached_neon_map_in&) const;
+	void regenerate_neon_map(const cached_neon_map_in&, augs::thread_pool* tile_workers = nullptr) const;
 
 	augs::path_type get_source_image_path() const;
 	vec2u read_source_image_size() const;
@@ -1,4 +1,13 @@
 #pragma once
+#include <cstddef>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define PARTICLE_INTEGRATION_SSE 1
+#include <xmmintrin.h>
+#else
+#define PARTICLE_INTEGRATION_SSE 0
+#endif
+
 #include "particle_types.h"
 
 template <class T, class = void>
@@ -31,6 +40,139 @@ FORCE_INLINE void general_particle::integrate(const float dt) {
 	generic_integrate_particle(*this, dt);
 }
 
+/*
+	The same as integrate, 
+	but the damping is written without branches and the constants are hoisted.
+	Serves as the scalar fallback of integrate_general_particles, and for the remainder of a run.
+*/
+
+FORCE_INLINE void integrate_general_particle_branchless(general_particle& p, const float dt, const float lifetime_dt) {
+	p.vel += p.acc * dt;
+	p.pos += p.vel * dt;
+
+	{
+		const auto damping = p.linear_damping * dt;
+		const auto speed = p.vel.length();
+		const auto mult = speed > damping ? (speed - damping) / speed : 0.f;
+
+		p.vel *= mult;
+	}
+
+	p.current_lifetime_ms += lifetime_dt;
+
+	p.rotation += p.rotation_speed * dt;
+
+	{
+		const auto damping = p.angular_damping * dt;
+		p.rotation_speed = std::copysign(std::max(0.f, std::abs(p.rotation_speed) - damping), p.rotation_speed);
+	}
+}
+
+#if PARTICLE_INTEGRATION_SSE
+/*
+	The kernel below loads the fields as four consecutive floats at a time,
+	so their order in general_particle must stay as it is.
+*/
+
+static_assert(offsetof(general_particle, vel) == offsetof(general_particle, pos) + 2 * sizeof(float));
+static_assert(offsetof(general_particle, acc) + 4 * sizeof(float) <= sizeof(general_particle));
+static_assert(offsetof(general_particle, rotation_speed) == offsetof(general_particle, rotation) + 1 * sizeof(float));
+static_assert(offsetof(general_particle, linear_damping) == offsetof(general_particle, rotation) + 2 * sizeof(float));
+static_assert(offsetof(general_particle, angular_damping) == offsetof(general_particle, rotation) + 3 * sizeof(float));
+#endif
+
+/*
+	Integrates a contiguous run of general particles.
+
+	With SSE, four particles at a time are transposed into structure-of-arrays lanes
+	(all positions x, all positions y, all velocities x...), integrated with packed instructions
+	and transposed back. The result is bit-identical to integrate_general_particle_branchless.
+*/
+
+FORCE_INLINE void integrate_general_particles(general_particle* const first, const std::size_t n, const float dt) {
+	const auto lifetime_dt = dt * 1000;
+
+	std::size_t i = 0;
+
+#if PARTICLE_INTEGRATION_SSE
+	const auto dt4 = _mm_set1_ps(dt);
+	const auto zero4 = _mm_setzero_ps();
+	const auto sign_mask4 = _mm_set1_ps(-0.f);
+
+	for (; i + 4 <= n; i += 4) {
+		general_particle* const p = first + i;
+
+		auto pos_x = _mm_loadu_ps(&p[0].pos.x);
+		auto pos_y = _mm_loadu_ps(&p[1].pos.x);
+		auto vel_x = _mm_loadu_ps(&p[2].pos.x);
+		auto vel_y = _mm_loadu_ps(&p[3].pos.x);
+		_MM_TRANSPOSE4_PS(pos_x, pos_y, vel_x, vel_y);
+
+		auto acc_x = _mm_loadu_ps(&p[0].acc.x);
+		auto acc_y = _mm_loadu_ps(&p[1].acc.x);
+		auto acc_rest_a = _mm_loadu_ps(&p[2].acc.x);
+		auto acc_rest_b = _mm_loadu_ps(&p[3].acc.x);
+		_MM_TRANSPOSE4_PS(acc_x, acc_y, acc_rest_a, acc_rest_b);
+
+		auto rotation = _mm_loadu_ps(&p[0].rotation);
+		auto rotation_speed = _mm_loadu_ps(&p[1].rotation);
+		auto linear_damping = _mm_loadu_ps(&p[2].rotation);
+		auto angular_damping = _mm_loadu_ps(&p[3].rotation);
+		_MM_TRANSPOSE4_PS(rotation, rotation_speed, linear_damping, angular_damping);
+
+		vel_x = _mm_add_ps(vel_x, _mm_mul_ps(acc_x, dt4));
+		vel_y = _mm_add_ps(vel_y, _mm_mul_ps(acc_y, dt4));
+
+		pos_x = _mm_add_ps(pos_x, _mm_mul_ps(vel_x, dt4));
+		pos_y = _mm_add_ps(pos_y, _mm_mul_ps(vel_y, dt4));
+
+		{
+			const auto damping = _mm_mul_ps(linear_damping, dt4);
+			const auto speed = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vel_x, vel_x), _mm_mul_ps(vel_y, vel_y)));
+
+			/* Lanes where the speed does not exceed the damping (including the zero speed) are masked to zero. */
+			const auto mult = _mm_and_ps(
+				_mm_cmpgt_ps(speed, damping),
+				_mm_div_ps(_mm_sub_ps(speed, damping), speed)
+			);
+
+			vel_x = _mm_mul_ps(vel_x, mult);
+			vel_y = _mm_mul_ps(vel_y, mult);
+		}
+
+		rotation = _mm_add_ps(rotation, _mm_mul_ps(rotation_speed, dt4));
+
+		{
+			const auto damping = _mm_mul_ps(angular_damping, dt4);
+			const auto magnitude = _mm_max_ps(_mm_sub_ps(_mm_andnot_ps(sign_mask4, rotation_speed), damping), zero4);
+
+			rotation_speed = _mm_or_ps(magnitude, _mm_and_ps(sign_mask4, rotation_speed));
+		}
+
+		_MM_TRANSPOSE4_PS(pos_x, pos_y, vel_x, vel_y);
+		_mm_storeu_ps(&p[0].pos.x, pos_x);
+		_mm_storeu_ps(&p[1].pos.x, pos_y);
+		_mm_storeu_ps(&p[2].pos.x, vel_x);
+		_mm_storeu_ps(&p[3].pos.x, vel_y);
+
+		_MM_TRANSPOSE4_PS(rotation, rotation_speed, linear_damping, angular_damping);
+		_mm_storeu_ps(&p[0].rotation, rotation);
+		_mm_storeu_ps(&p[1].rotation, rotation_speed);
+		_mm_storeu_ps(&p[2].rotation, linear_damping);
+		_mm_storeu_ps(&p[3].rotation, angular_damping);
+
+		p[0].current_lifetime_ms += lifetime_dt;
+		p[1].current_lifetime_ms += lifetime_dt;
+		p[2].current_lifetime_ms += lifetime_dt;
+		p[3].current_lifetime_ms += lifetime_dt;
+	}
+#endif
+
+	for (; i < n; ++i) {
+		integrate_general_particle_branchless(first[i], dt, lifetime_dt);
+	}
+}
+
 FORCE_INLINE bool general_particle::is_dead() const {
 	return current_lifetime_ms >= max_lifetime_ms;
 }
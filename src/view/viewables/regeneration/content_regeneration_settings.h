@@ -7,5 +7,6 @@ struct content_regeneration_settings {
 
 	unsigned atlas_blitting_threads = 2;
 	unsigned neon_regeneration_threads = 2;
+	unsigned sound_decoding_threads = 2;
 	// END GEN INTROSPECTOR
 };
\ No newline at end of file
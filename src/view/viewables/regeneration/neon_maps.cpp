@@ -1,8 +1,18 @@
 #include <sstream>
+#include <cmath>
+#include <cstdint>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define NEON_BLUR_SSE 1
+#include <xmmintrin.h>
+#else
+#define NEON_BLUR_SSE 0
+#endif
 
 #include "augs/filesystem/file.h"
 #include "augs/filesystem/directory.h"
-#include "augs/misc/simple_pair.h"
+#include "augs/templates/thread_pool.h"
+#include "augs/templates/container_templates.h"
 
 #include "augs/ensure.h"
 #include "augs/readwrite/memory_stream.h"
@@ -18,7 +28,8 @@
 
 void make_neon(
 	const neon_map_input& input,
-	augs::image& source
+	augs::image& source,
+	augs::thread_pool* tile_workers
 );
 
 std::optional<cached_neon_map_in> should_regenerate_neon_map(
@@ -71,7 +82,8 @@ void regenerate_neon_map(
 	const augs::path_type& input_image_path,
 	const augs::path_type& output_image_path,
 	const neon_map_input in,
-	cached_neon_map_in cached_in
+	cached_neon_map_in cached_in,
+	augs::thread_pool* const tile_workers
 ) try {
 	neon_map_stamp new_stamp;
 	new_stamp.input = in;
@@ -86,7 +98,7 @@ void regenerate_neon_map(
 	source_image.clear();
 	source_image.from_file(input_image_path);
 
-	make_neon(in, source_image);
+	make_neon(in, source_image, tile_workers);
 
 	source_image.save(neon_map_path);
 
@@ -98,8 +110,9 @@ catch (...) {
 }
 
 void generate_gauss_kernel(
-	const neon_map_input& input,
-	std::vector<double>& result
+	float standard_deviation,
+	unsigned size,
+	std::vector<float>& result
 );
 
 void scan_and_hide_undesired_pixels(
@@ -115,76 +128,310 @@ void resize_image(
 
 void cut_empty_edges(augs::image& source);
 
-/* Thread local usage actually makes this slower, I have no idea why. */
+/* out[i] = max(out[i], in[i] * w) */
 
-void make_neon(
+static void max_scaled(float* const out, const float* const in, const float w, const unsigned n) {
+	unsigned i = 0;
+
+#if NEON_BLUR_SSE
+	const auto ww = _mm_set1_ps(w);
+
+	for (; i + 4 <= n; i += 4) {
+		_mm_storeu_ps(out + i, _mm_max_ps(_mm_loadu_ps(out + i), _mm_mul_ps(_mm_loadu_ps(in + i), ww)));
+	}
+#endif
+
+	for (; i < n; ++i) {
+		out[i] = std::max(out[i], in[i] * w);
+	}
+}
+
+/* out[i] += in[i] * w */
+
+static void add_scaled(float* const out, const float* const in, const float w, const unsigned n) {
+	unsigned i = 0;
+
+#if NEON_BLUR_SSE
+	const auto ww = _mm_set1_ps(w);
+
+	for (; i + 4 <= n; i += 4) {
+		_mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(_mm_loadu_ps(in + i), ww)));
+	}
+#endif
+
+	for (; i < n; ++i) {
+		out[i] += in[i] * w;
+	}
+}
+
+/*
+	Splits the rows into bands and processes them on all workers,
+	or all at once on this thread if there are no workers.
+*/
+
+template <class F>
+static void for_each_band_of_rows(augs::thread_pool* const workers, const unsigned rows, F&& callback) {
+	if (workers == nullptr || workers->size() == 0) {
+		callback(0u, rows);
+		return;
+	}
+
+	const auto num_bands = static_cast<unsigned>(std::min(std::size_t(rows), (workers->size() + 1) * 4));
+
+	for (unsigned b = 0; b < num_bands; ++b) {
+		const auto first = static_cast<unsigned>(std::size_t(rows) * b / num_bands);
+		const auto last = static_cast<unsigned>(std::size_t(rows) * (b + 1) / num_bands);
+
+		workers->enqueue([&callback, first, last]() { callback(first, last); });
+	}
+
+	workers->submit();
+	workers->help_until_no_tasks();
+	workers->wait_for_all_tasks_to_complete();
+}
+
+/*
+	Every light pixel casts a gaussian glow and a pixel takes the strongest glow that reaches it.
+
+	The gaussian is a product of two 1D kernels with positive weights,
+	so the strongest glow over the 2D kernel is the strongest over columns of the strongest over rows.
+	This lets the blur run in a horizontal and a vertical 1D pass,
+	instead of splatting the whole 2D kernel around every light pixel.
+
+	If the lights differ in color, the color of a pixel is
+	the average of the nearby lights weighted by the same kernel, which is separable as well.
+*/
+
+struct neon_blur_planes {
+	std::vector<float> strength;
+	std::vector<float> weight;
+	std::vector<float> red;
+	std::vector<float> green;
+	std::vector<float> blue;
+	std::vector<uint8_t> row_has_light;
+
+	void reset(const std::size_t num_pixels, const std::size_t num_rows, const bool with_colors) {
+		strength.assign(num_pixels, 0.f);
+		row_has_light.assign(num_rows, 0);
+
+		if (with_colors) {
+			weight.assign(num_pixels, 0.f);
+			red.assign(num_pixels, 0.f);
+			green.assign(num_pixels, 0.f);
+			blue.assign(num_pixels, 0.f);
+		}
+	}
+};
+
+static void blur_neon_lights(
 	const neon_map_input& input,
-	augs::image& source
+	augs::image& source,
+	const std::vector<uint8_t>& light_mask,
+	const std::optional<rgba> uniform_color,
+	augs::thread_pool* const workers
 ) {
-	const auto radius = input.radius;
+	const auto cols = source.get_columns();
+	const auto rows = source.get_rows();
+	const bool with_colors = uniform_color == std::nullopt;
 
-	resize_image(source, radius);
+	thread_local std::vector<float> kernel_x_;
+	thread_local std::vector<float> kernel_y_;
+	thread_local neon_blur_planes horizontal_;
 
-	thread_local std::vector<double> kernel_;
-	thread_local std::vector<vec2u> pixel_coordinates_;
-	thread_local std::vector<rgba> pixels_original_;
+	auto& kernel_x = kernel_x_;
+	auto& kernel_y = kernel_y_;
+	auto& horizontal = horizontal_;
 
-	auto& kernel = kernel_;
-	auto& pixel_coordinates = pixel_coordinates_;
-	auto& pixels_original = pixels_original_; 
+	generate_gauss_kernel(input.standard_deviation, input.radius.x, kernel_x);
+	generate_gauss_kernel(input.standard_deviation, input.radius.y, kernel_y);
 
-	pixel_coordinates.clear();
-	pixels_original.clear();
+	horizontal.reset(std::size_t(cols) * rows, rows, with_colors);
 
-	scan_and_hide_undesired_pixels(source, input.light_colors, pixel_coordinates);
-	generate_gauss_kernel(input, kernel);
+	const auto half_x = static_cast<int>(input.radius.x / 2);
+	const auto half_y = static_cast<int>(input.radius.y / 2);
 
-	for (const auto p : pixel_coordinates) {
-		pixels_original.emplace_back(source.pixel(p));
-	}
+	/* The glow reaches from source + (0 - half) to source + (size - 1 - half). */
 
-	const auto radius_rows = radius.y;
-	const auto radius_cols = radius.x;
-	const auto source_rows = source.get_rows();
-	const auto source_cols = source.get_columns();
+	for_each_band_of_rows(workers, rows, [&](const unsigned first_row, const unsigned last_row) {
+		thread_local std::vector<float> lights_;
+		thread_local std::vector<float> red_;
+		thread_local std::vector<float> green_;
+		thread_local std::vector<float> blue_;
 
-	for (std::size_t i = 0; i < pixel_coordinates.size(); ++i) {
-		const auto coord = pixel_coordinates[i];
-		const auto current_light_pixel = pixels_original[i];
+		auto& lights = lights_;
+		auto& red = red_;
+		auto& green = green_;
+		auto& blue = blue_;
 
-		for (unsigned y = 0; y < radius_rows; ++y) {
-			for (unsigned x = 0; x < radius_cols; ++x) {
-				const unsigned current_index_y = coord.y + y - radius.y / 2;
+		lights.resize(cols);
 
-				if (current_index_y >= source_rows) {
+		if (with_colors) {
+			red.resize(cols);
+			green.resize(cols);
+			blue.resize(cols);
+		}
+
+		for (unsigned y = first_row; y < last_row; ++y) {
+			const auto row_offset = std::size_t(y) * cols;
+			bool any_light = false;
+
+			for (unsigned x = 0; x < cols; ++x) {
+				const auto is_light = light_mask[row_offset + x] != 0;
+
+				lights[x] = is_light ? 1.f : 0.f;
+				any_light = any_light || is_light;
+
+				if (with_colors) {
+					const auto& p = source.pixel(static_cast<unsigned>(row_offset + x));
+
+					red[x] = lights[x] * p.r;
+					green[x] = lights[x] * p.g;
+					blue[x] = lights[x] * p.b;
+				}
+			}
+
+			if (!any_light) {
+				continue;
+			}
+
+			horizontal.row_has_light[y] = 1;
+
+			for (unsigned t = 0; t < input.radius.x; ++t) {
+				const auto w = kernel_x[t];
+				const auto dx = static_cast<int>(t) - half_x;
+
+				const auto begin = static_cast<unsigned>(std::max(0, dx));
+				const auto end = static_cast<unsigned>(std::min(static_cast<int>(cols), static_cast<int>(cols) + dx));
+
+				if (begin >= end) {
 					continue;
 				}
 
-				const unsigned current_index_x = coord.x + x - radius.x / 2;
+				const auto n = end - begin;
+				const auto from = begin - dx;
+
+				max_scaled(horizontal.strength.data() + row_offset + begin, lights.data() + from, w, n);
 
-				if (current_index_x >= source_cols) {
+				if (with_colors) {
+					add_scaled(horizontal.weight.data() + row_offset + begin, lights.data() + from, w, n);
+					add_scaled(horizontal.red.data() + row_offset + begin, red.data() + from, w, n);
+					add_scaled(horizontal.green.data() + row_offset + begin, green.data() + from, w, n);
+					add_scaled(horizontal.blue.data() + row_offset + begin, blue.data() + from, w, n);
+				}
+			}
+		}
+	});
+
+	const auto max_alpha = 255.f * input.amplification;
+
+	for_each_band_of_rows(workers, rows, [&](const unsigned first_row, const unsigned last_row) {
+		thread_local neon_blur_planes vertical_;
+		auto& vertical = vertical_;
+
+		for (unsigned y = first_row; y < last_row; ++y) {
+			vertical.reset(cols, 1, with_colors);
+
+			bool any_glow = false;
+
+			for (unsigned t = 0; t < input.radius.y; ++t) {
+				const auto dy = static_cast<int>(t) - half_y;
+				const auto from_row = static_cast<int>(y) - dy;
+
+				if (from_row < 0 || from_row >= static_cast<int>(rows) || !horizontal.row_has_light[from_row]) {
 					continue;
 				}
 
-				if (const auto alpha = std::min(255u, static_cast<unsigned>(255 * kernel[y * radius_cols + x] * input.amplification))) {
-					auto& drawn_pixel = source.pixel({ current_index_x, current_index_y });
+				any_glow = true;
 
-					if (drawn_pixel == PIXEL_NONE) {
-						drawn_pixel[2] = current_light_pixel[2];
-						drawn_pixel[1] = current_light_pixel[1];
-						drawn_pixel[0] = current_light_pixel[0];
-					}
+				const auto w = kernel_y[t];
+				const auto from = std::size_t(from_row) * cols;
 
-					else if (drawn_pixel != current_light_pixel) {
-						drawn_pixel[2] = static_cast<rgba_channel>((alpha * current_light_pixel[2] + drawn_pixel[3] * drawn_pixel[2]) / (alpha + drawn_pixel[3]));
-						drawn_pixel[1] = static_cast<rgba_channel>((alpha * current_light_pixel[1] + drawn_pixel[3] * drawn_pixel[1]) / (alpha + drawn_pixel[3]));
-						drawn_pixel[0] = static_cast<rgba_channel>((alpha * current_light_pixel[0] + drawn_pixel[3] * drawn_pixel[0]) / (alpha + drawn_pixel[3]));
-					}
+				max_scaled(vertical.strength.data(), horizontal.strength.data() + from, w, cols);
 
-					drawn_pixel[3] = std::max(drawn_pixel[3], static_cast<rgba_channel>(alpha));
+				if (with_colors) {
+					add_scaled(vertical.weight.data(), horizontal.weight.data() + from, w, cols);
+					add_scaled(vertical.red.data(), horizontal.red.data() + from, w, cols);
+					add_scaled(vertical.green.data(), horizontal.green.data() + from, w, cols);
+					add_scaled(vertical.blue.data(), horizontal.blue.data() + from, w, cols);
 				}
 			}
+
+			if (!any_glow) {
+				continue;
+			}
+
+			const auto row_offset = std::size_t(y) * cols;
+
+			for (unsigned x = 0; x < cols; ++x) {
+				const auto alpha = static_cast<unsigned>(std::min(255.f, max_alpha * vertical.strength[x]));
+
+				if (alpha == 0) {
+					continue;
+				}
+
+				auto& drawn_pixel = source.pixel(static_cast<unsigned>(row_offset + x));
+
+				if (with_colors) {
+					const auto total = vertical.weight[x];
+
+					drawn_pixel[0] = static_cast<rgba_channel>(std::min(255.f, vertical.red[x] / total));
+					drawn_pixel[1] = static_cast<rgba_channel>(std::min(255.f, vertical.green[x] / total));
+					drawn_pixel[2] = static_cast<rgba_channel>(std::min(255.f, vertical.blue[x] / total));
+				}
+				else {
+					drawn_pixel[0] = uniform_color->r;
+					drawn_pixel[1] = uniform_color->g;
+					drawn_pixel[2] = uniform_color->b;
+				}
+
+				drawn_pixel[3] = std::max(drawn_pixel[3], static_cast<rgba_channel>(alpha));
+			}
+		}
+	});
+}
+
+void make_neon(
+	const neon_map_input& input,
+	augs::image& source,
+	augs::thread_pool* const tile_workers
+) {
+	const auto radius = input.radius;
+
+	resize_image(source, radius);
+
+	thread_local std::vector<vec2u> pixel_coordinates_;
+	thread_local std::vector<rgba> pixels_original_;
+	thread_local std::vector<uint8_t> light_mask_;
+
+	auto& pixel_coordinates = pixel_coordinates_;
+	auto& pixels_original = pixels_original_; 
+	auto& light_mask = light_mask_;
+
+	pixel_coordinates.clear();
+	pixels_original.clear();
+
+	scan_and_hide_undesired_pixels(source, input.light_colors, pixel_coordinates);
+
+	light_mask.assign(std::size_t(source.get_columns()) * source.get_rows(), 0);
+
+	std::optional<rgba> uniform_color;
+
+	for (const auto p : pixel_coordinates) {
+		const auto light = source.pixel(p);
+
+		if (pixels_original.empty()) {
+			uniform_color = light;
+		}
+		else if (uniform_color && (uniform_color->r != light.r || uniform_color->g != light.g || uniform_color->b != light.b)) {
+			uniform_color = std::nullopt;
 		}
+
+		pixels_original.emplace_back(light);
+		light_mask[std::size_t(p.y) * source.get_columns() + p.x] = 1;
+	}
+
+	if (!pixel_coordinates.empty() && radius.x > 0 && radius.y > 0) {
+		blur_neon_lights(input, source, light_mask, uniform_color, tile_workers);
 	}
 
 	for (std::size_t i = 0; i < pixel_coordinates.size(); ++i) {
@@ -198,48 +445,33 @@ void make_neon(
 	}
 }
 
-void generate_gauss_kernel(const neon_map_input& input, std::vector<double>& result) {
-	const auto radius = input.radius;
-	const auto rows = radius.y;
-	const auto cols = radius.x;
-	const auto total_pixels = rows * cols;
-
-	thread_local std::vector<augs::simple_pair<int, int>> index_;
-	auto& index = index_;
-
-	index.resize(total_pixels);
-	result.resize(total_pixels);
-
-	{
-		const auto max_index_x = radius.x / 2;
-		const auto max_index_y = radius.y / 2;
-
-		for (unsigned y = 0; y < radius.y; ++y) {
-			for (unsigned x = 0; x < radius.x; ++x) {
-				index[y * cols + x] = { 
-					static_cast<int>(x - max_index_x),
-				   	static_cast<int>(y - max_index_y)
-				};
-			}
-		}
-	}
+/* A normalized 1D gaussian. The outer product of two of these is the normalized 2D gaussian. */
 
-	for (unsigned i = 0; i < total_pixels; ++i) {
-		result[i] = std::exp(-1 * (std::pow(index[i].first, 2) + std::pow(index[i].second, 2)) / 2 / std::pow(input.standard_deviation, 2)) / PI<float> / 2 / std::pow(input.standard_deviation, 2);
-	}
+void generate_gauss_kernel(
+	const float standard_deviation,
+	const unsigned size,
+	std::vector<float>& result
+) {
+	result.resize(size);
 
-	double sum = 0.f;
+	const auto half = static_cast<int>(size / 2);
+	const auto variance = static_cast<double>(standard_deviation) * standard_deviation;
 
-	for (const auto& v : result) {
+	double sum = 0.0;
+
+	for (unsigned i = 0; i < size; ++i) {
+		const auto d = static_cast<double>(static_cast<int>(i) - half);
+		const auto v = std::exp(-d * d / 2 / variance);
+
+		result[i] = static_cast<float>(v);
 		sum += v;
 	}
 
 	for (auto& v : result) {
-		v /= sum;
+		v = static_cast<float>(v / sum);
 	}
 }
 
-
 void scan_and_hide_undesired_pixels(
 	augs::image& original_image,
 	const std::vector<rgba>& color_whitelist,
@@ -7,6 +7,10 @@
 #include "augs/filesystem/path.h"
 #include "augs/filesystem/file_time_type.h"
 
+namespace augs {
+	class thread_pool;
+}
+
 struct neon_map_input {
 	// GEN INTROSPECTOR struct neon_map_input
 	float standard_deviation = 6.f;
@@ -44,5 +48,13 @@ void regenerate_neon_map(
 	const augs::path_type& input_image_path,
 	const augs::path_type& output_image_path,
 	const neon_map_input in,
-	cached_neon_map_in
-);
\ No newline at end of file
+	cached_neon_map_in,
+	augs::thread_pool* tile_workers = nullptr
+);
+
+/*
+	Images at least this large are regenerated one at a time,
+	with their rows split between all regeneration workers.
+*/
+
+constexpr unsigned NEON_MAP_TILED_MIN_PIXELS = 512 * 512;
\ No newline at end of file
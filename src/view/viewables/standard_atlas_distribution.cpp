@@ -25,6 +25,7 @@ void regenerate_and_gather_subjects(
 		int total_to_regenerate = 0;
 
 		std::vector<std::optional<cached_neon_map_in>> neon_regen_inputs;
+		std::vector<bool> neon_regen_tiled;
 
 		for (const auto& d : in.image_definitions) {
 			const bool force = in.settings.regenerate_every_time;
@@ -32,28 +33,37 @@ void regenerate_and_gather_subjects(
 			const auto def = make_view(d);
 
 			auto result = def.should_regenerate_neon_map(force);
+			bool tiled = false;
 
 			if (result != std::nullopt) {
 				++total_to_regenerate;
+
+				try {
+					tiled = def.read_source_image_size().area() >= NEON_MAP_TILED_MIN_PIXELS;
+				}
+				catch (...) {
+
+				}
 			}
 
 			neon_regen_inputs.emplace_back(std::move(result));
+			neon_regen_tiled.push_back(tiled);
 		}
 
 		if (in.progress) {
 			in.progress->max_neon_maps.store(total_to_regenerate);
 		}
 
-		auto worker = [make_view, &in, &neon_regen_inputs](const image_definition& d) {
+		auto worker = [make_view, &in, &neon_regen_inputs, &neon_regen_tiled](const image_definition& d) {
 			const auto this_i = index_in(in.image_definitions.get_objects(), d);
 
-			const auto this_cached_in = neon_regen_inputs[this_i];
+			const auto& this_cached_in = neon_regen_inputs[this_i];
 			const auto def = make_view(d);
 
 			const bool force = in.settings.regenerate_every_time;
 			def.regenerate_desaturation(force);
 
-			if (this_cached_in) {
+			if (this_cached_in && !neon_regen_tiled[this_i]) {
 				if (in.progress) {
 					in.progress->current_neon_map_num.fetch_add(1, std::memory_order_relaxed);
 				}
@@ -75,6 +85,24 @@ void regenerate_and_gather_subjects(
 			workers.submit();
 			workers.help_until_no_tasks();
 			workers.wait_for_all_tasks_to_complete();
+
+			/*
+				A single large image would otherwise keep one worker busy long after the others are done,
+				so these are done last, each split between all workers.
+			*/
+
+			for (const auto& d : in.image_definitions) {
+				const auto this_i = index_in(in.image_definitions.get_objects(), d);
+				const auto& this_cached_in = neon_regen_inputs[this_i];
+
+				if (this_cached_in && neon_regen_tiled[this_i]) {
+					if (in.progress) {
+						in.progress->current_neon_map_num.fetch_add(1, std::memory_order_relaxed);
+					}
+
+					make_view(d).regenerate_neon_map(*this_cached_in, std::addressof(workers));
+				}
+			}
 		}
 
 		for (const auto& d : in.image_definitions) {
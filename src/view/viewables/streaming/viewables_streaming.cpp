@@ -1,4 +1,6 @@
 #include "augs/log.h"
+#include <mutex>
+#include <condition_variable>
 #include <unordered_set>
 #include "augs/graphics/renderer.h"
 #include "augs/templates/thread_templates.h"
@@ -9,6 +11,9 @@
 
 #include "augs/audio/audio_command_buffers.h"
 #include "augs/audio/audio_backend.h"
+#include "augs/audio/sound_data.h"
+#include "augs/templates/thread_pool.h"
+#include "augs/misc/scope_guard.h"
 #include "view/viewables/regeneration/atlas_progress_structs.h"
 #include "augs/misc/imgui/imgui_control_wrappers.h"
 #include "augs/misc/imgui/imgui_scope_wrappers.h"
@@ -276,26 +281,132 @@ void viewables_streaming::load_all(const viewables_load_input in) {
 		});
 
 		if (sound_requests.size() > 0) {
+			/* The loading thread only uploads, unless there is a single decoding thread, in which case it does everything. */
+			const auto num_decoding_threads = std::size_t(in.settings.sound_decoding_threads);
+			const auto num_decoding_workers = num_decoding_threads > 1 ? num_decoding_threads : 0;
+
 			future_loaded_buffers = launch_async(
-				[&](){
+				[&, num_decoding_workers](){
 					using value_type = decltype(future_loaded_buffers.get());
 
+					/* 
+						Decoding is what takes time and it needs no OpenAL,
+						so it is split between workers. Each sound is uploaded as soon as it is decoded,
+						in whatever order the decoders finish, and its decoded samples are freed right after.
+						A decoder only starts on another sound when fewer than max_held sounds
+						are being decoded or waiting for upload, so that is the most ever held at once.
+					*/
+
+					const auto n = sound_requests.size();
+
+					std::vector<std::optional<std::vector<augs::sound_data>>> decoded;
+					decoded.resize(n);
+
+					auto decode = [&](const std::size_t i) {
+						try {
+							decoded[i] = augs::decode_sound_variations(sound_requests[i].second);
+						}
+						catch (...) {
+
+						}
+					};
+
 					value_type result;
+					result.resize(n);
 
-					for (const auto& r : sound_requests) {
-						if (r.second.source_sound.empty()) {
-							/* A request to unload. */
-							result.push_back(std::nullopt);
-							continue;
+					auto upload = [&](const std::size_t i) {
+						if (decoded[i] == std::nullopt) {
+							return;
 						}
 
 						try {
-							augs::sound_buffer b = r.second;
-							result.emplace_back(std::move(b));
+							augs::sound_buffer b(*decoded[i], sound_requests[i].second.settings);
+							result[i].emplace(std::move(b));
 						}
 						catch (...) {
-							result.push_back(std::nullopt);
+
+						}
+
+						decoded[i] = std::nullopt;
+					};
+
+					auto is_unload_request = [&](const std::size_t i) {
+						return sound_requests[i].second.source_sound.empty();
+					};
+
+					static augs::thread_pool decoders = 0;
+					decoders.resize(num_decoding_workers);
+
+					if (decoders.size() == 0) {
+						for (std::size_t i = 0; i < n; ++i) {
+							if (!is_unload_request(i)) {
+								decode(i);
+								upload(i);
+							}
+						}
+
+						return result;
+					}
+
+					const auto max_held = 2 * decoders.size();
+
+					std::mutex decoded_lk;
+					std::condition_variable decoded_cv;
+					std::condition_variable room_cv;
+					std::vector<std::size_t> just_decoded;
+					std::size_t num_held = 0;
+					std::size_t num_pending = 0;
+
+					for (std::size_t i = 0; i < n; ++i) {
+						if (is_unload_request(i)) {
+							continue;
+						}
+
+						decoders.enqueue([&, i]() {
+							{
+								std::unique_lock<std::mutex> lock(decoded_lk);
+								room_cv.wait(lock, [&]() { return num_held < max_held; });
+								++num_held;
+							}
+
+							decode(i);
+
+							{
+								std::unique_lock<std::mutex> lock(decoded_lk);
+								just_decoded.push_back(i);
+							}
+
+							decoded_cv.notify_one();
+						});
+
+						++num_pending;
+					}
+
+					decoders.submit();
+
+					auto wait_for_all_decoders = augs::scope_guard([&]() {
+						decoders.wait_for_all_tasks_to_complete();
+					});
+
+					for (; num_pending > 0; --num_pending) {
+						std::size_t i = 0;
+
+						{
+							std::unique_lock<std::mutex> lock(decoded_lk);
+							decoded_cv.wait(lock, [&]() { return !just_decoded.empty(); });
+
+							i = just_decoded.back();
+							just_decoded.pop_back();
 						}
+
+						upload(i);
+
+						{
+							std::unique_lock<std::mutex> lock(decoded_lk);
+							--num_held;
+						}
+
+						room_cv.notify_one();
 					}
 
 					return result;
@@ -3,13 +3,19 @@
 #endif
 
 #include <functional>
+#include <thread>
+#include <atomic>
+#include <chrono>
 
 #include "fp_consistency_tests.h"
+#include "tick_benchmark.h"
+#include "render_benchmark.h"
 
 #include "augs/log_path_getters.h"
 #include "augs/unit_tests.h"
 #include "augs/global_libraries.h"
 
+#include "augs/misc/scope_guard.h"
 #include "augs/templates/identity_templates.h"
 #include "augs/templates/container_templates.h"
 #include "augs/templates/history.hpp"
@@ -38,6 +44,7 @@
 #include "game/organization/all_messages_includes.h"
 #include "game/detail/inventory/inventory_slot_handle.h"
 #include "game/detail/entity_handle_mixins/inventory_mixin.hpp"
+#include "game/detail/static_render_chunks.h"
 
 #include "game/cosmos/data_living_one_step.h"
 #include "game/cosmos/cosmos.h"
@@ -269,6 +276,23 @@ work_result work(const int argc, const char* const * const argv) try {
 		LOG("Unit tests were disabled.");
 	}
 
+	if (params.benchmark_ticks != -1) {
+		auto settings = tick_benchmark_settings();
+
+		settings.arena = params.benchmark_arena;
+		settings.ticks = params.benchmark_ticks;
+		settings.bots = params.benchmark_bots;
+		settings.num_logic_pool_workers = config.server.num_logic_pool_workers;
+		settings.report_filename = get_path_in_log_files("tick_benchmark.json");
+
+		if (!params.benchmark_report.empty()) {
+			settings.report_filename = params.benchmark_report;
+		}
+
+		const bool benchmark_succeeded = perform_tick_benchmark(lua, settings);
+		return benchmark_succeeded ? work_result::SUCCESS : work_result::FAILURE;
+	}
+
 	LOG("Initializing ImGui.");
 
 	static const auto imgui_ini_path = std::string(USER_FILES_DIR) + "/" + get_preffix_for(current_app_type) + "imgui.ini";
@@ -626,26 +650,140 @@ work_result work(const int argc, const char* const * const argv) try {
 
 		auto& server = std::get<server_setup>(*current_setup);
 
-		while (server.is_running()) {
+		auto run_arena = [&](
+			server_setup& arena,
+			network_profiler& arena_performance,
+			server_network_info& arena_stats,
+			auto should_stop
+		) {
 			const auto zoom = 1.f;
 
+			augs::network_waiter tick_waiter;
+			std::vector<netcode_socket_handle_t> watched_sockets;
+
+			while (arena.is_running()) {
+				if (should_stop()) {
+					return;
+				}
+
+				arena.advance(
+					{
+						vec2i(),
+						config.input,
+						zoom,
+						get_detected_nat(),
+						arena_performance,
+						arena_stats
+					},
+					solver_callbacks()
+				);
+
+				if (!arena.uses_precise_tick_scheduler()) {
+					arena.sleep_until_next_tick();
+					continue;
+				}
+
+				watched_sockets.clear();
+
+				if (const auto socket = arena.find_underlying_socket()) {
+					watched_sockets.push_back(socket->handle);
+				}
+
+				tick_waiter.watch(watched_sockets);
+
+				if (arena.wait_until_next_tick(tick_waiter) == augs::network_wait_result::PACKET) {
+					arena.receive_packets_between_ticks();
+				}
+			}
+		};
+
+		/* 
+			Additional arenas run on their own threads so that a slow arena never delays the others.
+			Each owns everything its server writes to: the lua state, the STUN provider and the network statistics.
+			Arenas that load the same map share its common significant state through the reinferred arena cache.
+		*/
+
+		std::atomic<bool> stop_all_arenas = false;
+		std::atomic<uint32_t> num_running_additional_arenas = 0;
+		std::vector<std::thread> additional_arenas;
+
+		auto join_additional_arenas = augs::scope_guard([&]() {
+			stop_all_arenas = true;
+
+			for (auto& t : additional_arenas) {
+				t.join();
+			}
+		});
+
+		for (uint32_t i = 1; i < config.dedicated_server.num_arenas; ++i) {
+			++num_running_additional_arenas;
+
+			additional_arenas.emplace_back([&, i]() {
+				auto mark_as_stopped = augs::scope_guard([&]() {
+					--num_running_additional_arenas;
+				});
+
+				try {
+					auto arena_start = start;
+					arena_start.port = static_cast<port_type>(bound_port + i);
+
+					auto arena_vars = config.server;
+					arena_vars.server_name = typesafe_sprintf("%x #%x", std::string(config.server.server_name), i + 1);
+
+					LOG("Starting an additional arena at port: %x", arena_start.port);
+
+					auto arena_lua = augs::create_lua_state();
+					auto arena_stun_provider = stun_provider;
+
+					network_profiler arena_performance;
+					server_network_info arena_stats;
+
+					auto arena = std::make_unique<server_setup>(
+						arena_lua,
+						arena_start,
+						arena_vars,
+						config.server_solvable,
+						config.client,
+						config.private_server,
+						config.dedicated_server,
+
+						server_nat_traversal_input {
+							config.nat_detection,
+							config.nat_traversal,
+
+							arena_stun_provider
+						}
+					);
+
+					if (!arena->is_running()) {
+						LOG("Failed to start the arena at port: %x", arena_start.port);
+						return;
+					}
+
+					run_arena(*arena, arena_performance, arena_stats, [&]() { return stop_all_arenas.load(); });
+
+					LOG("The arena at port %x has stopped.", arena_start.port);
+				}
+				catch (const std::exception& err) {
+					LOG("The arena #%x has failed: %x", i + 1, err.what());
+				}
+			});
+		}
+
+		auto stop_on_sigint = [&]() {
 			if (handle_sigint()) {
-				return work_result::SUCCESS;
+				stop_all_arenas = true;
 			}
 
-			server.advance(
-				{
-					vec2i(),
-					config.input,
-					zoom,
-					get_detected_nat(),
-					network_performance,
-					server_stats
-				},
-				solver_callbacks()
-			);
+			return stop_all_arenas.load();
+		};
+
+		run_arena(server, network_performance, server_stats, stop_on_sigint);
 
-			server.sleep_until_next_tick();
+		/* The process keeps serving until every arena has stopped. */
+
+		while (num_running_additional_arenas > 0 && !stop_on_sigint()) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(100));
 		}
 #endif
 
@@ -706,6 +844,35 @@ work_result work(const int argc, const char* const * const argv) try {
 		config.drawing
 	);
 
+	if (params.benchmark_frames != -1) {
+		auto settings = render_benchmark_settings();
+
+		settings.arena = params.benchmark_arena;
+		settings.frames = params.benchmark_frames;
+		settings.ticks_per_frame = params.benchmark_ticks_per_frame;
+		settings.bots = params.benchmark_bots;
+		settings.report_filename = get_path_in_log_files("render_benchmark.json");
+
+		if (!params.benchmark_report.empty()) {
+			settings.report_filename = params.benchmark_report;
+		}
+
+		const bool benchmark_succeeded = perform_render_benchmark(
+			lua,
+			settings,
+			{
+				config,
+				logic_get_screen_size(),
+				necessary_fbos,
+				necessary_shaders,
+				audio_buffers,
+				thread_pool
+			}
+		);
+
+		return benchmark_succeeded ? work_result::SUCCESS : work_result::FAILURE;
+	}
+
 	LOG("Initializing the necessary sounds.");
 	static all_necessary_sounds necessary_sounds(
 		"content/necessary/sfx"
@@ -1751,6 +1918,7 @@ work_result work(const int argc, const char* const * const argv) try {
 	*/
 
 	static visible_entities all_visible;
+	static static_render_chunks all_static_chunks;
 
 	static auto get_character_camera = [&]() -> character_camera {
 		return { get_viewed_character(), { get_camera_eye(), logic_get_screen_size() } };
@@ -1774,7 +1942,8 @@ work_result work(const int argc, const char* const * const argv) try {
 			queried_cone, 
 			accuracy_type::PROXIMATE,
 			get_render_layer_filter(),
-			tree_of_npo_filter::all()
+			tree_of_npo_filter::all(),
+			std::addressof(all_static_chunks)
 		});
 
 		all_visible.sort(cosm);
@@ -3176,6 +3345,7 @@ work_result work(const int argc, const char* const * const argv) try {
 				});
 
 				game_thread_performance.num_triangles.measure(extract_num_total_drawn_triangles());
+				game_thread_performance.num_drawcalls.measure(get_write_buffer().renderers.extract_num_total_drawcalls());
 
 				buffer_swapper.wait_swap();
 